@@ -32,6 +32,9 @@
 
 #include "../contam/PrjModel.hpp"
 #include "../contam/PrjAirflowElements.hpp"
+#include "../contam/PrjReader.hpp"
+
+#include <chrono>
 
 // Test adding airflow elements
 TEST_F(AirflowFixture, ContamModel_AirflowElements) {
@@ -139,3 +142,67 @@ TEST_F(AirflowFixture, ContamModel_Zones) {
   EXPECT_EQ(zone1, model.zones()[1]);
   EXPECT_EQ(zone2, model.zones()[2]);
 }
+
+// Verify the PRJ tokenizer
+TEST_F(AirflowFixture, ContamModel_Reader) {
+  std::string input = "! comment line\r\n"
+                      "3  4.5\tx name ! trailing comment\r\n"
+                      "\r\n"
+                      "7\n"
+                      "! another comment\n"
+                      "a whole line\n"
+                      "section line 1\n"
+                      "! kept in the section\n"
+                      "-999\n"
+                      "-999 end of section\n"
+                      "* end project file.";
+  openstudio::contam::Reader reader(input);
+  EXPECT_EQ(3, reader.readInt());
+  EXPECT_EQ(2, reader.lineNumber());
+  EXPECT_EQ("4.5x", reader.readString());
+  EXPECT_EQ("name", reader.readString());
+  // The comment ends the line, blank lines are skipped
+  EXPECT_EQ(7u, reader.readUInt());
+  EXPECT_EQ(4, reader.lineNumber());
+  EXPECT_EQ("a whole line", reader.readLine());
+  EXPECT_EQ(6, reader.lineNumber());
+  EXPECT_EQ("section line 1\n! kept in the section\n-999\n", reader.readSection());
+  EXPECT_EQ(9, reader.lineNumber());
+  EXPECT_NO_THROW(reader.read999());
+  EXPECT_NO_THROW(reader.readEnd());
+  EXPECT_THROW(reader.readString(), std::exception);
+}
+
+TEST_F(AirflowFixture, ContamModel_ReaderThroughput) {
+  // A large path section, one element per line
+  std::stringstream ss;
+  const int n = 100000;
+  ss << n << " ! paths\n";
+  for (int i = 1; i <= n; ++i) {
+    ss << i << " 0 -1 1 1 3 1 0 0 0 0 0 1.5 2.5 0.5 0 0 0 0 0 0 0 0 0 1.2e-05 3 0 0 0 0\r\n";
+  }
+  ss << "-999\n";
+  std::string input = ss.str();
+
+  auto start = std::chrono::steady_clock::now();
+  openstudio::contam::Reader reader(input);
+  int count = reader.readInt();
+  ASSERT_EQ(n, count);
+  double sum = 0;
+  for (int i = 0; i < count; ++i) {
+    EXPECT_EQ(i + 1, reader.readInt());
+    for (int j = 0; j < 11; ++j) {
+      reader.readInt();
+    }
+    sum += reader.readDouble();
+    for (int j = 0; j < 17; ++j) {
+      reader.readString();
+    }
+  }
+  reader.read999();
+  auto end = std::chrono::steady_clock::now();
+
+  EXPECT_DOUBLE_EQ(1.5 * n, sum);
+  double mb = static_cast<double>(input.size()) / (1024.0 * 1024.0);
+  std::cout << "Reader: " << mb / std::chrono::duration<double>(end - start).count() << " MB/s" << std::endl;
+}
@@ -0,0 +1,135 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include <fstream>
+
+TEST_F(AirflowFixture, SimFile_ReadResults) {
+  openstudio::path simPath = openstudio::tempDir() / openstudio::toPath("AirflowSimFileTest.sim");
+
+  openstudio::path lfrPath = simPath;
+  lfrPath.replace_extension(openstudio::toPath("lfr").string());
+  {
+    std::ofstream lfr(openstudio::toSystemFilename(lfrPath));
+    lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+    lfr << "1/1\t00:00:00\t1\t0.5\t0.1\t0.0\n";
+    lfr << "1/1\t00:00:00\t3\t-0.5\t-0.2\t0.0\n";
+    lfr << "1/1\t01:00:00\t1\t1.5\t0.3\t0.1\n";
+    lfr << "1/1\t01:00:00\t3\t-1.5\t-0.4\t0.0\n";
+    lfr << "1/1\t02:00:00\t3\t-2.5\t-0.6\t0.0\n";
+    lfr << "1/1\t02:00:00\t1\t2.5\t0.5\t0.1\n";
+  }
+
+  openstudio::path nfrPath = simPath;
+  nfrPath.replace_extension(openstudio::toPath("nfr").string());
+  {
+    std::ofstream nfr(openstudio::toSystemFilename(nfrPath));
+    nfr << "day\ttime\tZ#\tT\tP\tD\n";
+    nfr << "1/1\t00:00:00\t0\t273.15\t0.0\t-\n";
+    nfr << "1/1\t00:00:00\t1\t293.15\t1.0\t1.2\n";
+    nfr << "1/1\t01:00:00\t0\t274.15\t0.0\t-\n";
+    nfr << "1/1\t01:00:00\t1\t294.15\t2.0\t1.1\n";
+    nfr << "1/1\t02:00:00\t0\t275.15\t0.0\t-\n";
+    nfr << "1/1\t02:00:00\t1\t295.15\t3.0\t1.0\n";
+  }
+
+  openstudio::contam::SimFile sim(simPath);
+  ASSERT_EQ(3u, sim.fileDateTimes().size());
+  ASSERT_EQ(2u, sim.dateTimes().size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 2, 0, 0)), sim.dateTimes()[1]);
+
+  // Rows for a time step need not be in the same order
+  ASSERT_EQ(2u, sim.dP().size());
+  EXPECT_EQ(std::vector<double>({0.5, 1.5, 2.5}), sim.dP()[0]);
+  EXPECT_EQ(std::vector<double>({-0.5, -1.5, -2.5}), sim.dP()[1]);
+
+  boost::optional<openstudio::TimeSeries> flow = sim.pathFlow(1);
+  ASSERT_TRUE(flow);
+  ASSERT_EQ(2u, flow->values().size());
+  EXPECT_DOUBLE_EQ(0.25, flow->values()[0]);
+  EXPECT_DOUBLE_EQ(0.5, flow->values()[1]);
+  EXPECT_EQ("kg/s", flow->units());
+
+  boost::optional<openstudio::TimeSeries> deltaP = sim.pathDeltaP(3);
+  ASSERT_TRUE(deltaP);
+  EXPECT_DOUBLE_EQ(-1.0, deltaP->values()[0]);
+  EXPECT_DOUBLE_EQ(-2.0, deltaP->values()[1]);
+
+  EXPECT_FALSE(sim.pathFlow(2));
+
+  // The ambient node does not report a density
+  boost::optional<openstudio::TimeSeries> density = sim.nodeDensity(0);
+  ASSERT_TRUE(density);
+  EXPECT_DOUBLE_EQ(0.0, density->values()[0]);
+  boost::optional<openstudio::TimeSeries> temperature = sim.nodeTemperature(1);
+  ASSERT_TRUE(temperature);
+  EXPECT_DOUBLE_EQ(293.65, temperature->values()[0]);
+  EXPECT_DOUBLE_EQ(294.65, temperature->values()[1]);
+  EXPECT_FALSE(sim.nodePressure(2));
+
+  openstudio::filesystem::remove(lfrPath);
+  openstudio::filesystem::remove(nfrPath);
+}
+
+TEST_F(AirflowFixture, SimFile_EmptyColumn) {
+  openstudio::path simPath = openstudio::tempDir() / openstudio::toPath("AirflowSimFileEmptyColumnTest.sim");
+
+  // An empty field must not be read from the next column
+  openstudio::path lfrPath = simPath;
+  lfrPath.replace_extension(openstudio::toPath("lfr").string());
+  {
+    std::ofstream lfr(openstudio::toSystemFilename(lfrPath));
+    lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+    lfr << "1/1\t00:00:00\t1\t0.5\t0.1\t0.0\n";
+    lfr << "1/1\t01:00:00\t1\t\t0.3\t0.1\n";
+  }
+
+  openstudio::path nfrPath = simPath;
+  nfrPath.replace_extension(openstudio::toPath("nfr").string());
+  {
+    std::ofstream nfr(openstudio::toSystemFilename(nfrPath));
+    nfr << "day\ttime\tZ#\tT\tP\tD\n";
+    nfr << "1/1\t00:00:00\t\t293.15\t1.0\t1.2\n";
+  }
+
+  openstudio::contam::SimFile sim(simPath);
+  EXPECT_TRUE(sim.fileDateTimes().empty());
+  EXPECT_TRUE(sim.dP().empty());
+  EXPECT_FALSE(sim.pathDeltaP(1));
+  EXPECT_TRUE(sim.T().empty());
+  EXPECT_FALSE(sim.nodeTemperature(1));
+
+  openstudio::filesystem::remove(lfrPath);
+  openstudio::filesystem::remove(nfrPath);
+}
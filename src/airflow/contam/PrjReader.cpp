@@ -38,14 +38,56 @@
 namespace openstudio {
 namespace contam {
 
-  Reader::Reader(openstudio::filesystem::ifstream& file) : m_stream(openstudio::filesystem::read_as_string(file)), m_lineNumber(0) {}
+  Reader::Reader(openstudio::filesystem::ifstream& file)
+    : m_buffer(openstudio::filesystem::read_as_string(file)), m_position(0), m_lineNumber(0), m_entryIndex(0) {}
 
-  Reader::Reader(const std::string& string, int starting) : m_lineNumber(starting) {
-    m_stream.str(string);
-  }
+  Reader::Reader(const std::string& string, int starting) : m_buffer(string), m_position(0), m_lineNumber(starting), m_entryIndex(0) {}
 
   Reader::~Reader() {}
 
+  bool Reader::nextLine(size_t& begin, size_t& end) {
+    // Same semantics as std::getline: fails only if there is nothing left to read
+    if (m_position >= m_buffer.size()) {
+      return false;
+    }
+    begin = m_position;
+    end = m_buffer.find('\n', m_position);
+    if (end == std::string::npos) {
+      end = m_buffer.size();
+      m_position = end;
+    } else {
+      m_position = end + 1;
+    }
+    return true;
+  }
+
+  void Reader::nextDataLine(size_t& begin, size_t& end) {
+    // Read the next line that is not a comment
+    do {
+      if (!nextLine(begin, end)) {
+        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
+      }
+      m_lineNumber++;
+    } while (begin != end && m_buffer[begin] == '!');
+  }
+
+  void Reader::tokenize(size_t begin, size_t end) {
+    // Entries are separated by spaces, any carriage returns and tabs inside an entry are dropped
+    m_entries.clear();
+    m_entryIndex = 0;
+    std::string entry;
+    for (size_t i = begin; i <= end; ++i) {
+      if (i == end || m_buffer[i] == ' ') {
+        if (!entry.empty()) {
+          m_entries.push_back(entry);
+          entry.clear();
+        }
+      } else if (m_buffer[i] != '\r' && m_buffer[i] != '\t') {
+        entry += m_buffer[i];
+      }
+    }
+  }
+
   double Reader::readDouble() {
     const auto string = readString();
     try {
@@ -57,43 +99,17 @@ namespace contam {
 
   std::string Reader::readString() {
     while (1) {
-      while (m_entries.size() == 0) {
-        std::string input;
-        std::getline(m_stream, input);
-        LOG(Debug, "Line read: " << input);
-        if (!m_stream) {
-          LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-        }
-        m_lineNumber++;
-        while (input[0] == '!') {
-          std::getline(m_stream, input);
-          LOG(Debug, "Line read: " << input);
-          if (!m_stream) {
-            LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-          }
-          m_lineNumber++;
-        }
-
-        std::vector<std::string> strs;
-        boost::split(strs, input, boost::is_any_of(" "));
-
-        m_entries.clear();
-        for (const auto& s : strs) {
-          std::string s2 = boost::replace_all_copy(s, " ", "");
-          boost::replace_all(s2, "\r", "");
-          boost::replace_all(s2, "\n", "");
-          boost::replace_all(s2, "\t", "");
-          if (!s2.empty()) {
-            m_entries.push_back(s2);
-          }
-        }
+      while (m_entryIndex >= m_entries.size()) {
+        size_t begin = 0;
+        size_t end = 0;
+        nextDataLine(begin, end);
+        tokenize(begin, end);
       }
-      std::string out = m_entries.front();
-      m_entries.pop_front();
+      std::string out = std::move(m_entries[m_entryIndex++]);
       if (out[0] == '!') {
         m_entries.clear();
+        m_entryIndex = 0;
       } else {
-        LOG(Debug, "String return: " << out);
         return out;
       }
     }
@@ -123,25 +139,12 @@ namespace contam {
 
   std::string Reader::readLine() {
     /* Dump any other input */
-    if (m_entries.size()) {
-      m_entries.clear();
-    }
-    std::string input;
-    std::getline(m_stream, input);
-    LOG(Debug, "Line read: " << input);
-    if (!m_stream) {
-      LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-    }
-    m_lineNumber++;
-    while (input[0] == '!') {
-      std::getline(m_stream, input);
-      LOG(Debug, "Line read: " << input);
-      if (!m_stream) {
-        LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
-      }
-      m_lineNumber++;
-    }
-    return input;
+    m_entries.clear();
+    m_entryIndex = 0;
+    size_t begin = 0;
+    size_t end = 0;
+    nextDataLine(begin, end);
+    return m_buffer.substr(begin, end - begin);
   }
 
   void Reader::read999() {
@@ -170,19 +173,23 @@ namespace contam {
   }
 
   std::string Reader::readSection() {
-    std::string section;
+    size_t sectionBegin = m_position;
     while (1) {
-      std::string input;
-      std::getline(m_stream, input);
-      if (!m_stream) {
+      size_t begin = 0;
+      size_t end = 0;
+      if (!nextLine(begin, end)) {
         LOG_AND_THROW("Failed to read input at line " << m_lineNumber);
       }
       m_lineNumber++;
-      section += std::string(input + '\n');
-      if (input.find("-999") == 0) {
+      if (m_buffer.compare(begin, 4, "-999") == 0) {
         break;
       }
     }
+    std::string section = m_buffer.substr(sectionBegin, m_position - sectionBegin);
+    // Every line in the section is newline terminated, even if the input ended without one
+    if (section.empty() || section.back() != '\n') {
+      section += '\n';
+    }
     return section;
   }
 
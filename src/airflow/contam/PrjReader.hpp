@@ -31,6 +31,8 @@
 #define AIRFLOW_CONTAM_PRJREADER_HPP
 
 #include <sstream>
+#include <string>
+#include <vector>
 #include "../../utilities/core/Logger.hpp"
 #include "../../utilities/core/Filesystem.hpp"
 
@@ -82,10 +84,16 @@ namespace contam {
    private:
     std::string readStdString();
     std::string readLineString();
+    bool nextLine(size_t& begin, size_t& end);
+    void nextDataLine(size_t& begin, size_t& end);
+    void tokenize(size_t begin, size_t end);
 
-    std::stringstream m_stream;
+    // The whole input is held in one buffer and scanned in place, tokens are only copied out when returned
+    std::string m_buffer;
+    size_t m_position;
     int m_lineNumber;
-    std::list<std::string> m_entries;
+    std::vector<std::string> m_entries;
+    size_t m_entryIndex;
 
     REGISTER_LOGGER("openstudio.contam.Reader");
   };
@@ -29,19 +29,40 @@
 
 #include "SimFile.hpp"
 
+#include "../../utilities/core/StringHelpers.hpp"
+
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/classification.hpp>
 
+#include <algorithm>
+
 namespace openstudio {
 namespace contam {
 
-  int indexOf(const std::vector<int>& list, int target) {
-    for (size_t i = 0; i < list.size(); ++i) {
-      if (list[i] == target) {
-        return i;
+  static int indexOf(const std::map<int, int>& index, int target) {
+    auto it = index.find(target);
+    if (it == index.end()) {
+      return -1;
+    }
+    return it->second;
+  }
+
+  // Splits a tab delimited line into [begin, end) ranges without copying the fields
+  static void splitTabs(const std::string& line, std::vector<std::pair<const char*, const char*>>& fields) {
+    fields.clear();
+    const char* begin = line.c_str();
+    const char* end = begin + line.size();
+    if (begin != end && *(end - 1) == '\r') {
+      --end;
+    }
+    for (;;) {
+      const char* tab = std::find(begin, end, '\t');
+      fields.emplace_back(begin, tab);
+      if (tab == end) {
+        break;
       }
+      begin = tab + 1;
     }
-    return -1;
   }
 
   SimFile::SimFile(openstudio::path path) {
@@ -83,115 +104,104 @@ namespace contam {
     return true;
   }
 
-  void SimFile::clearLfr() {
-    m_dP.clear();
-    m_F0.clear();
-    m_F1.clear();
-  }
+  bool SimFile::readResults(const std::string& fileName, bool nodes, std::vector<int>& nrs, std::map<int, int>& nrIndex,
+                            const std::array<std::vector<std::vector<double>>*, 3>& columns, std::vector<std::string>& day,
+                            std::vector<std::string>& time) {
+    const char* fileType = nodes ? "NFR" : "LFR";
+    const char* names[] = {nodes ? "node number" : "link number", nodes ? "temperature" : "pressure difference", nodes ? "pressure" : "flow 0",
+                           nodes ? "density" : "flow 1"};
 
-  bool SimFile::readLfr(const std::string& fileName) {
-    clearLfr();
-    std::vector<std::string> day;
-    std::vector<std::string> time;
     openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
     if (!file.is_open()) {
-      LOG(Error, "Failed to open LFR file '" << fileName << "'");
+      LOG(Error, "Failed to open " << fileType << " file '" << fileName << "'");
       return false;
     }
-    std::map<int, int> nrMap;
+
     // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
+    std::string line;
+    std::getline(file, line);
+    if (line.empty()) {
+      LOG(Error, "No data in " << fileType << " file '" << fileName << "'");
       return false;
     }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
+    std::vector<std::pair<const char*, const char*>> row;
+    splitTabs(line, row);
     unsigned ncols = 6;
-    if (row.size() != ncols) {
-      LOG(Error, "LFR file has " << row.size() << " columns, not the expected " << ncols);
+    auto validColumnCount = [&]() { return row.size() == ncols || (nodes && row.size() == ncols + 2); };
+    if (!validColumnCount()) {
+      LOG(Error, fileType << " file has " << row.size() << " columns, not the expected " << ncols);
       return false;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols) {
-        clearLfr();
-        LOG(Error, "LFR data line has " << row.size() << " columns, not the expected " << ncols);
+
+    // Read the data; the line buffer and field ranges are reused so that no per-row strings are allocated.
+    // Results are written for each time step in the same path/node order, so try the slot after the last one first
+    size_t nextIndex = 0;
+    while (std::getline(file, line)) {
+      if (line.empty() || line == "\r") {
+        continue;
+      }
+      splitTabs(line, row);
+      if (!validColumnCount()) {
+        LOG(Error, fileType << " data line has " << row.size() << " columns, not the expected " << ncols);
         return false;
       }
-      if (time.size()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
-        }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
+      if (time.empty() || time.back().compare(0, std::string::npos, row[1].first, row[1].second - row[1].first) != 0) {
+        day.emplace_back(row[0].first, row[0].second);
+        time.emplace_back(row[1].first, row[1].second);
       }
 
       int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid link number '" << row[2] << "'");
+      if (!string_conversions::parse(row[2].first, row[2].second, nr)) {
+        LOG(Error, "Invalid " << names[0] << " '" << std::string(row[2].first, row[2].second) << "'");
         return false;
       }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_dP.resize(sz + 1);
-        m_F0.resize(sz + 1);
-        m_F1.resize(sz + 1);
-      }
-      double dP = 0;
-      try {
-        dP = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid pressure difference '" << row[3] << "'");
-        return false;
+      size_t index;
+      if (nextIndex < nrs.size() && nrs[nextIndex] == nr) {
+        index = nextIndex;
+      } else {
+        auto inserted = nrIndex.insert(std::make_pair(nr, static_cast<int>(nrs.size())));
+        if (inserted.second) {
+          nrs.push_back(nr);
+          for (auto* column : columns) {
+            column->emplace_back();
+          }
+        }
+        index = inserted.first->second;
       }
-
-      double F0 = 0;
-      try {
-        F0 = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 0 '" << row[4] << "'");
-        return false;
+      nextIndex = (index + 1) % nrs.size();
+
+      for (unsigned i = 0; i < 3; ++i) {
+        double value = 0;
+        if (!string_conversions::parse(row[3 + i].first, row[3 + i].second, value)) {
+          // Node 0 is the ambient node and may not report a density
+          if (!(nodes && i == 2 && nr == 0)) {
+            LOG(Error, "Invalid " << names[1 + i] << " '" << std::string(row[3 + i].first, row[3 + i].second) << "'");
+            return false;
+          }
+          value = 0.0;
+        }
+        (*columns[i])[index].push_back(value);
       }
+    }
+    return true;
+  }
 
-      double F1 = 0;
-      try {
-        F1 = std::stod(row[5]);
-      } catch (const std::exception&) {
-        clearLfr();
-        LOG(Error, "Invalid flow 1 '" << row[5] << "'");
-        return false;
-      }
+  void SimFile::clearLfr() {
+    m_pathNr.clear();
+    m_pathIndex.clear();
+    m_dP.clear();
+    m_F0.clear();
+    m_F1.clear();
+  }
 
-      m_dP[nrMap[nr]].push_back(dP);
-      m_F0[nrMap[nr]].push_back(F0);
-      m_F1[nrMap[nr]].push_back(F1);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_pathNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_pathNr[nrMap[keys[i]]] = keys[i];
+  bool SimFile::readLfr(const std::string& fileName) {
+    clearLfr();
+    std::vector<std::string> day;
+    std::vector<std::string> time;
+    if (!readResults(fileName, false, m_pathNr, m_pathIndex, {&m_dP, &m_F0, &m_F1}, day, time)) {
+      clearLfr();
+      return false;
     }
-    file.close();
     // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
     if (!computeDateTimes(day, time)) {
       clearLfr();
@@ -203,6 +213,8 @@ namespace contam {
   }
 
   void SimFile::clearNfr() {
+    m_nodeNr.clear();
+    m_nodeIndex.clear();
     m_T.clear();
     m_P.clear();
     m_D.clear();
@@ -212,115 +224,15 @@ namespace contam {
     clearNfr();
     std::vector<std::string> day;
     std::vector<std::string> time;
-    openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-    if (file.is_open()) {
-      LOG(Error, "Failed to open NFR file '" << fileName << "'");
-      return false;
-    }
-
-    std::map<int, int> nrMap;
-    // Read the header
-    std::string headerstr;
-    std::getline(file, headerstr);
-    std::string header = headerstr;
-    if (header.empty()) {
-      LOG(Error, "No data in LFR file '" << fileName << "'");
-      return false;
-    }
-    std::vector<std::string> row;
-    boost::split(row, header, boost::is_any_of("\t"));
-    unsigned ncols = 6;
-    if (row.size() != ncols && row.size() != ncols + 2) {
-      LOG(Error, "NFR file has " << row.size() << " columns, not the expected " << ncols);
+    if (!readResults(fileName, true, m_nodeNr, m_nodeIndex, {&m_T, &m_P, &m_D}, day, time)) {
+      clearNfr();
       return false;
     }
-    // Read the data
-    while (file.good()) {
-      std::string linestr;
-      std::getline(file, linestr);
-      std::string line = linestr;
-
-      std::vector<std::string> row;
-      boost::split(row, line, boost::is_any_of("\t"));
-      if (row.size() != ncols && row.size() != ncols + 2) {
-        clearNfr();
-        LOG(Error, "NFR data line has " << row.size() << " columns, not the expected " << ncols);
-        return false;
-      }
-      if (time.size()) {
-        if (time[time.size() - 1] != row[1]) {
-          day.push_back(row[0]);
-          time.push_back(row[1]);
-        }
-      } else {
-        day.push_back(row[0]);
-        time.push_back(row[1]);
-      }
-
-      int nr = 0;
-      try {
-        nr = std::stoi(row[2]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid node number '" << row[2] << "'");
-        return false;
-      }
-      if (nrMap.find(nr) == nrMap.end()) {
-        int sz = nrMap.size();
-        nrMap[nr] = sz;
-        m_T.resize(sz + 1);
-        m_P.resize(sz + 1);
-        m_D.resize(sz + 1);
-      }
-      double T = 0;
-      try {
-        T = std::stod(row[3]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid temperature '" << row[3] << "'");
-        return false;
-      }
-
-      double P = 0;
-      try {
-        P = std::stod(row[4]);
-      } catch (const std::exception&) {
-        clearNfr();
-        LOG(Error, "Invalid pressure '" << row[4] << "'");
-        return false;
-      }
-
-      double D = 0;
-      try {
-        D = std::stod(row[5]);
-      } catch (const std::exception&) {
-        if (nr == 0) {
-          D = 0.0;
-        } else {
-          clearNfr();
-          LOG(Error, "Invalid density '" << row[5] << "'");
-          return false;
-        }
-      }
-      m_T[nrMap[nr]].push_back(T);
-      m_P[nrMap[nr]].push_back(P);
-      m_D[nrMap[nr]].push_back(D);
-    }
-    // Unwind the zone number map;
-    std::vector<int> keys;
-    for (const auto& pair : nrMap) {
-      keys.push_back(pair.first);
-    }
-    m_nodeNr.resize(keys.size());
-    for (std::vector<int>::size_type i = 0; i < keys.size(); ++i) {
-      m_nodeNr[nrMap[keys[i]]] = keys[i];
-    }
-    file.close();
     // Something should probably be done here to make sure that the times here match up with what we
     // already have. For now, if nothing is known about the dates, then try to compute it
     if (m_dateTimes.size() == 0) {
       if (!computeDateTimes(day, time)) {
-        clearLfr();
+        clearNfr();
         m_dateTimes.clear();
         LOG(Error, "Failed to compute date and time objects from NFR input");
         return false;
@@ -329,23 +241,22 @@ namespace contam {
     return true;
   }
 
-  static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes, std::vector<double> inputValues, std::string units) {
+  static openstudio::TimeSeries convertData(const std::vector<openstudio::DateTime>& inputDateTimes, const std::vector<double>& inputValues,
+                                            const std::string& units) {
     // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-    std::vector<openstudio::DateTime> dateTimes;
-    std::vector<double> values;
     if (inputDateTimes.size() == 1)  // Account for steady simulation results
     {
       return openstudio::TimeSeries(inputDateTimes, createVector(inputValues), units);
     }
+    Vector values(inputDateTimes.size() - 1);
     for (unsigned i = 1; i < inputDateTimes.size(); i++) {
-      dateTimes.push_back(inputDateTimes[i]);
-      values.push_back(0.5 * (inputValues[i - 1] + inputValues[i]));
+      values[i - 1] = 0.5 * (inputValues[i - 1] + inputValues[i]);
     }
-    return openstudio::TimeSeries(dateTimes, createVector(values), units);
+    return openstudio::TimeSeries(std::vector<openstudio::DateTime>(inputDateTimes.begin() + 1, inputDateTimes.end()), values, units);
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const {
-    int index = indexOf(m_pathNr, nr);
+    int index = indexOf(m_pathIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -354,7 +265,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const {
-    int index = indexOf(m_pathNr, nr);
+    int index = indexOf(m_pathIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -363,7 +274,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const {
-    int index = indexOf(m_pathNr, nr);
+    int index = indexOf(m_pathIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -372,7 +283,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const {
-    int index = indexOf(m_pathNr, nr);
+    int index = indexOf(m_pathIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -386,7 +297,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
+    int index = indexOf(m_nodeIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -395,7 +306,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
+    int index = indexOf(m_nodeIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
@@ -404,7 +315,7 @@ namespace contam {
   }
 
   boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const {
-    int index = indexOf(m_nodeNr, nr);
+    int index = indexOf(m_nodeIndex, nr);
     if (index == -1) {
       return boost::optional<openstudio::TimeSeries>();
     }
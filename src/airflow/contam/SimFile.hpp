@@ -37,6 +37,9 @@
 
 #include "../AirflowAPI.hpp"
 
+#include <array>
+#include <map>
+
 namespace openstudio {
 namespace contam {
 
@@ -45,23 +48,23 @@ namespace contam {
    public:
     explicit SimFile(openstudio::path path);
 
-    // These are provided for advanced use
-    std::vector<std::vector<double>> dP() const {
+    // These are provided for advanced use, each inner vector holds the point results for one path or node
+    const std::vector<std::vector<double>>& dP() const {
       return m_dP;
     }
-    std::vector<std::vector<double>> F0() const {
+    const std::vector<std::vector<double>>& F0() const {
       return m_F0;
     }
-    std::vector<std::vector<double>> F1() const {
+    const std::vector<std::vector<double>>& F1() const {
       return m_F1;
     }
-    std::vector<std::vector<double>> T() const {
+    const std::vector<std::vector<double>>& T() const {
       return m_T;
     }
-    std::vector<std::vector<double>> P() const {
+    const std::vector<std::vector<double>>& P() const {
       return m_P;
     }
-    std::vector<std::vector<double>> D() const {
+    const std::vector<std::vector<double>>& D() const {
       return m_D;
     }
 
@@ -89,13 +92,17 @@ namespace contam {
     bool readLfr(const std::string& fileName);
     void clearNfr();
     bool readNfr(const std::string& fileName);
+    bool readResults(const std::string& fileName, bool nodes, std::vector<int>& nrs, std::map<int, int>& nrIndex,
+                     const std::array<std::vector<std::vector<double>>*, 3>& columns, std::vector<std::string>& day, std::vector<std::string>& time);
     bool computeDateTimes(const std::vector<std::string>& day, const std::vector<std::string>& time);
 
-    std::vector<int> m_pathNr;  // the CONTAM path index
+    std::vector<int> m_pathNr;       // the CONTAM path index
+    std::map<int, int> m_pathIndex;  // CONTAM path index to position in the results
     std::vector<std::vector<double>> m_dP;
     std::vector<std::vector<double>> m_F0;
     std::vector<std::vector<double>> m_F1;
-    std::vector<int> m_nodeNr;  // the CONTAM node index
+    std::vector<int> m_nodeNr;       // the CONTAM node index
+    std::map<int, int> m_nodeIndex;  // CONTAM node index to position in the results
     std::vector<std::vector<double>> m_T;
     std::vector<std::vector<double>> m_P;
     std::vector<std::vector<double>> m_D;
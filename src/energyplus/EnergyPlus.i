@@ -46,6 +46,10 @@
 %ignore ForwardTranslatorInitializer;
 %ignore openstudio::energyplus::detail::ForwardTranslatorInitializer;
 
+// std::function callbacks are not wrapped
+%ignore openstudio::energyplus::ErrorFile::ErrorFile(const MessageCallback&);
+%template(ErrorFileWarningCounts) std::map<std::string, unsigned>;
+
 %include <energyplus/ErrorFile.hpp>
 %include <energyplus/ForwardTranslator.hpp>
 %include <energyplus/ReverseTranslator.hpp>
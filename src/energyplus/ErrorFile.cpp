@@ -27,19 +27,189 @@
 *  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 ***********************************************************************************************************************/
 
+
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
-#include <boost/algorithm/string.hpp>
+#include <boost/optional.hpp>
+
+#include <cctype>
+#include <cstring>
 
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    // the lines of an err file are classified by hand rather than with regular expressions, the patterns matched are given in the comments
+
+    bool isSpace(char c) {
+      return (c == ' ') || (c == '\t') || (c == '\r') || (c == '\n') || (c == '\f') || (c == '\v');
+    }
+
+    const char* skipSpaces(const char* p, const char* end) {
+      while ((p != end) && isSpace(*p)) {
+        ++p;
+      }
+      return p;
+    }
+
+    const char* skipChar(const char* p, const char* end, char c) {
+      while ((p != end) && (*p == c)) {
+        ++p;
+      }
+      return p;
+    }
+
+    bool startsWith(const char* p, const char* end, const char* text) {
+      std::size_t size = std::strlen(text);
+      return (static_cast<std::size_t>(end - p) >= size) && (std::strncmp(p, text, size) == 0);
+    }
+
+    // "^\s*\**\s+\*\*\s*([[:alpha:]]+)\s*\*\*(.*)$" for a warning or error, type is set to the alpha group
+    // "^\s*\**\s+\*\*\s*~~~\s*\*\*(.*)$" for a continuation line
+    // returns the start of the rest of the line, or nullptr if the line does not match
+    const char* matchMessage(const char* begin, const char* end, bool continuation, std::string& type) {
+      // the first "**" is either the start of the leading stars, or follows the leading stars and some space
+      const char* stars = skipSpaces(begin, end);
+      const char* afterStars = skipChar(stars, end, '*');
+      const char* afterSpaces = skipSpaces(afterStars, end);
+
+      const char* candidates[2] = {nullptr, nullptr};
+      if ((stars != begin) && (afterStars - stars >= 2)) {
+        candidates[0] = stars + 2;
+      }
+      if ((afterStars != stars) && (afterSpaces != afterStars) && startsWith(afterSpaces, end, "**")) {
+        candidates[1] = afterSpaces + 2;
+      }
+
+      for (const char* p : candidates) {
+        if (!p) {
+          continue;
+        }
+        p = skipSpaces(p, end);
+        const char* typeBegin = p;
+        if (continuation) {
+          if (!startsWith(p, end, "~~~")) {
+            continue;
+          }
+          p += 3;
+        } else {
+          while ((p != end) && std::isalpha(static_cast<unsigned char>(*p))) {
+            ++p;
+          }
+          if (p == typeBegin) {
+            continue;
+          }
+        }
+        const char* typeEnd = p;
+        p = skipSpaces(p, end);
+        if (!startsWith(p, end, "**")) {
+          continue;
+        }
+        if (!continuation) {
+          type.assign(typeBegin, typeEnd);
+        }
+        return p + 2;
+      }
+      return nullptr;
+    }
+
+    // "^\s*\*+ " followed by text
+    bool matchStarredLine(const char* begin, const char* end, const char* text, const char** rest = nullptr) {
+      const char* stars = skipSpaces(begin, end);
+      const char* p = skipChar(stars, end, '*');
+      if ((p == stars) || !startsWith(p, end, " ")) {
+        return false;
+      }
+      ++p;
+      if (!startsWith(p, end, text)) {
+        return false;
+      }
+      if (rest) {
+        *rest = p + std::strlen(text);
+      }
+      return true;
+    }
+
+    // "^\s*\*+ EnergyPlus Completed Successfully.*" or "^\s*\*+ GroundTempCalc\S* Completed Successfully.*"
+    bool matchCompletedSuccessfully(const char* begin, const char* end) {
+      if (matchStarredLine(begin, end, "EnergyPlus Completed Successfully")) {
+        return true;
+      }
+      const char* p = nullptr;
+      if (matchStarredLine(begin, end, "GroundTempCalc", &p)) {
+        while ((p != end) && !isSpace(*p)) {
+          ++p;
+        }
+        return startsWith(p, end, " Completed Successfully");
+      }
+      return false;
+    }
+
+    // "^\s*\*+ EnergyPlus Terminated.*"
+    bool matchCompletedUnsuccessfully(const char* begin, const char* end) {
+      return matchStarredLine(begin, end, "EnergyPlus Terminated");
+    }
+
+    std::string trimmed(const char* begin, const char* end, bool left) {
+      if (left) {
+        begin = skipSpaces(begin, end);
+      }
+      while ((end != begin) && isSpace(*(end - 1))) {
+        --end;
+      }
+      return std::string(begin, end);
+    }
+
+    std::string messageTemplate(const std::string& message) {
+      std::string result;
+      std::string::size_type end = message.find('\n');
+      if (end == std::string::npos) {
+        end = message.size();
+      }
+      result.reserve(end);
+      for (std::string::size_type i = 0; i < end; ++i) {
+        if (std::isdigit(static_cast<unsigned char>(message[i]))) {
+          if (result.empty() || (result.back() != '#')) {
+            result.push_back('#');
+          }
+        } else {
+          result.push_back(message[i]);
+        }
+      }
+      return result;
+    }
+
+  }  // namespace
+
   /// constructor
-  ErrorFile::ErrorFile(const openstudio::path& errPath) : m_completed(false), m_completedSuccessfully(false) {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
+  ErrorFile::ErrorFile(const openstudio::path& errPath) : ErrorFile(MessageCallback()) {
+    openstudio::filesystem::ifstream ifs(errPath, std::ios_base::in | std::ios_base::binary);
+    std::vector<char> buffer(1 << 16);
+    while (!m_completed && ifs) {
+      ifs.read(buffer.data(), buffer.size());
+      parseText(buffer.data(), static_cast<std::size_t>(ifs.gcount()));
+    }
     ifs.close();
+    finish();
+  }
+
+  ErrorFile::ErrorFile() : ErrorFile(MessageCallback()) {}
+
+  ErrorFile::ErrorFile(const MessageCallback& callback)
+    : m_callback(callback), m_hasMessage(false), m_completed(false), m_completedSuccessfully(false) {}
+
+  void ErrorFile::parseText(const std::string& text) {
+    parseText(text.data(), text.size());
+  }
+
+  void ErrorFile::finish() {
+    if (!m_partialLine.empty()) {
+      std::string line;
+      line.swap(m_partialLine);
+      parseLine(line.data(), line.data() + line.size());
+    }
+    finishMessage();
   }
 
   /// get warnings
@@ -57,6 +227,10 @@ namespace energyplus {
     return m_fatalErrors;
   }
 
+  std::map<std::string, unsigned> ErrorFile::warningCounts() const {
+    return m_warningCounts;
+  }
+
   /// did EnergyPlus complete or crash
   bool ErrorFile::completed() const {
     return m_completed;
@@ -67,96 +241,90 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is) {
-    std::string line;
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([[:alpha:]]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-    // read the file line by line using regexes
-    bool alreadyGotLine = false;
-
-    while (alreadyGotLine || std::getline(is, line)) {
-
-      alreadyGotLine = false;
-      boost::smatch matches;
+  void ErrorFile::parseText(const char* data, std::size_t size) {
+    const char* end = data + size;
+    const char* lineBegin = data;
+    while (!m_completed && (lineBegin != end)) {
+      const char* lineEnd = static_cast<const char*>(std::memchr(lineBegin, '\n', end - lineBegin));
+      if (!lineEnd) {
+        // keep the incomplete line until the rest of it is parsed
+        m_partialLine.append(lineBegin, end);
+        return;
+      }
+      if (m_partialLine.empty()) {
+        parseLine(lineBegin, lineEnd);
+      } else {
+        m_partialLine.append(lineBegin, lineEnd);
+        std::string line;
+        line.swap(m_partialLine);
+        parseLine(line.data(), line.data() + line.size());
+      }
+      lineBegin = lineEnd + 1;
+    }
+  }
 
-      LOG(Debug, "Parsing ErrorFile Line '" << line << "'");
+  void ErrorFile::parseLine(const char* begin, const char* end) {
+    if (m_completed) {
+      return;
+    }
 
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)) {
+    // windows line endings
+    if ((end != begin) && (*(end - 1) == '\r')) {
+      --end;
+    }
 
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second);
-        boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second);
-        boost::trim(warningOrErrorString);
+    if (m_hasMessage) {
+      // read the rest of the multi line warning or error
+      if (const char* rest = matchMessage(begin, end, true, m_messageType)) {
+        m_message += "\n";
+        m_message += trimmed(rest, end, false);
+        return;
+      }
+      finishMessage();
+    }
 
-        // read the rest of the multi line warning or error
-        while (true) {
-          // std::streampos pos = is.tellg();
-          if (!std::getline(is, line)) {
-            break;
-          }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)) {
-            std::string temp = std::string(matches[1].first, matches[1].second);
-            boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          } else {
-            // unget the line
-            // is.seekg(pos);
-            // Instead of rewind then reread (which fails on Windows if you have LF line endings)
-            // We just use this bool to avoid having to re-read the line.
-            alreadyGotLine = true;
-            break;
-          }
-        }
+    if (const char* rest = matchMessage(begin, end, false, m_messageType)) {
+      m_hasMessage = true;
+      m_message = trimmed(rest, end, true);
+    } else if (matchCompletedSuccessfully(begin, end)) {
+      m_completed = true;
+      m_completedSuccessfully = true;
+    } else if (matchCompletedUnsuccessfully(begin, end)) {
+      m_completed = true;
+      m_completedSuccessfully = false;
+    }
+  }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
-
-        // correctly sort warnings and errors
-        try {
-          ErrorLevel level(warningOrErrorType);
-
-          switch (level.value()) {
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+  void ErrorFile::finishMessage() {
+    if (!m_hasMessage) {
+      return;
+    }
+    m_hasMessage = false;
 
-        } catch (...) {
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
-        }
+    // correctly sort warnings and errors
+    boost::optional<ErrorLevel> level;
+    try {
+      level = ErrorLevel(m_messageType);
+    } catch (...) {
+      LOG(Error, "Unknown warning or error level '" << m_messageType << "'");
+      return;
+    }
 
-      } else if (boost::regex_match(line, completedSuccessful) || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
+    switch (level->value()) {
+      case ErrorLevel::Warning:
+        ++m_warningCounts[messageTemplate(m_message)];
+        m_warnings.push_back(m_message);
         break;
-      } else if (boost::regex_match(line, completedUnsuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = false;
+      case ErrorLevel::Severe:
+        m_severeErrors.push_back(m_message);
         break;
-      }
+      case ErrorLevel::Fatal:
+        m_fatalErrors.push_back(m_message);
+        break;
+    }
+
+    if (m_callback) {
+      m_callback(*level, m_message);
     }
   }
 
@@ -36,6 +36,8 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -57,9 +59,24 @@ namespace energyplus {
   class ENERGYPLUS_API ErrorFile
   {
    public:
-    /// constructor
+    /// called with each complete warning or error as soon as it has been parsed
+    using MessageCallback = std::function<void(const ErrorLevel&, const std::string&)>;
+
+    /// constructor, parses the file at errPath
     ErrorFile(const openstudio::path& errPath);
 
+    /// constructor for incremental parsing with parseText, e.g. while EnergyPlus is still writing the file
+    ErrorFile();
+
+    /// constructor for incremental parsing, callback is called with each warning or error as it is parsed
+    explicit ErrorFile(const MessageCallback& callback);
+
+    /// parse the next chunk of an err file, an incomplete last line is kept until more text is parsed
+    void parseText(const std::string& text);
+
+    /// parse the incomplete last line and the last warning or error, call once the file is complete
+    void finish();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -69,6 +86,9 @@ namespace energyplus {
     /// get fatal errors
     std::vector<std::string> fatalErrors() const;
 
+    /// number of warnings by message template, the first line of the warning with each run of digits replaced by '#'
+    std::map<std::string, unsigned> warningCounts() const;
+
     /// did EnergyPlus complete or crash
     bool completed() const;
 
@@ -78,11 +98,20 @@ namespace energyplus {
    private:
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseText(const char* data, std::size_t size);
+    void parseLine(const char* begin, const char* end);
+    void finishMessage();
+
+    MessageCallback m_callback;
+    std::string m_partialLine;
+    bool m_hasMessage;
+    std::string m_messageType;
+    std::string m_message;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
     std::vector<std::string> m_fatalErrors;
+    std::map<std::string, unsigned> m_warningCounts;
     bool m_completed;
     bool m_completedSuccessfully;
   };
@@ -560,16 +560,16 @@ namespace energyplus {
   // struct for sorting children in forward translator
   struct ChildSorter
   {
-    ChildSorter(std::vector<IddObjectType>& iddObjectTypes) : m_iddObjectTypes(iddObjectTypes) {}
+    ChildSorter(const std::map<IddObjectType, size_t>& iddObjectTypeOrder) : m_iddObjectTypeOrder(iddObjectTypeOrder) {}
 
     // sort first by position in iddObjectTypes and then by name
     bool operator()(const model::ModelObject& a, const model::ModelObject& b) const {
-      auto ita = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), a.iddObject().type());
-      auto itb = std::find(m_iddObjectTypes.begin(), m_iddObjectTypes.end(), b.iddObject().type());
+      size_t ia = position(a.iddObject().type());
+      size_t ib = position(b.iddObject().type());
 
-      if (ita < itb) {
+      if (ia < ib) {
         return true;
-      } else if (ita > itb) {
+      } else if (ia > ib) {
         return false;
       }
 
@@ -586,7 +586,16 @@ namespace energyplus {
       return istringLess(aname, bname);
     }
 
-    std::vector<IddObjectType> m_iddObjectTypes;
+    // types not in the list sort last, as std::find would have returned end()
+    size_t position(const IddObjectType& iddObjectType) const {
+      auto it = m_iddObjectTypeOrder.find(iddObjectType);
+      if (it == m_iddObjectTypeOrder.end()) {
+        return m_iddObjectTypeOrder.size();
+      }
+      return it->second;
+    }
+
+    const std::map<IddObjectType, size_t>& m_iddObjectTypeOrder;
   };
 
   boost::optional<IdfObject> ForwardTranslator::translateAndMapModelObject(ModelObject& modelObject) {
@@ -2945,13 +2954,13 @@ namespace energyplus {
     OptionalParentObject opo = modelObject.optionalCast<ParentObject>();
     if (opo) {
       ModelObjectVector children = opo->children();
-      IddObjectTypeVector types = iddObjectsToTranslate();
+      const std::map<IddObjectType, size_t>& typeOrder = iddObjectsToTranslateOrder();
 
       // sort these objects as well
-      std::sort(children.begin(), children.end(), ChildSorter(types));
+      std::sort(children.begin(), children.end(), ChildSorter(typeOrder));
 
       for (auto& elem : children) {
-        if (std::find(types.begin(), types.end(), elem.iddObject().type()) != types.end()) {
+        if (typeOrder.find(elem.iddObject().type()) != typeOrder.end()) {
           translateAndMapModelObject(elem);
         }
       }
@@ -2975,6 +2984,19 @@ namespace energyplus {
     return result;
   }
 
+  const std::map<IddObjectType, size_t>& ForwardTranslator::iddObjectsToTranslateOrder() {
+    static const std::map<IddObjectType, size_t> result = []() {
+      std::map<IddObjectType, size_t> order;
+      std::vector<IddObjectType> types = iddObjectsToTranslate();
+      for (size_t i = 0; i < types.size(); ++i) {
+        // keep the first position if a type is listed twice, matching std::find
+        order.insert(std::make_pair(types[i], i));
+      }
+      return order;
+    }();
+    return result;
+  }
+
   std::vector<IddObjectType> ForwardTranslator::iddObjectsToTranslateInitializer() {
     std::vector<IddObjectType> result;
 
@@ -4377,25 +4399,18 @@ namespace energyplus {
       for (const auto& node : upstreamNodes) {
         auto spms = subsetCastVector<model::SetpointManagerMixedAir>(node.setpointManagers());
         for (auto& spm : spms) {
-          auto pred = [&spm](IdfObject& idfObject) {
-            if (idfObject.iddObject().type() == IddObjectType::SetpointManager_MixedAir) {
-              auto idfName = idfObject.name();
-              auto osName = spm.name();
-              if (idfName && osName && (osName.get() == idfName.get())) {
-                return true;
-              }
-            }
-            return false;
-          };
-          auto spm_idf = std::find_if(m_idfObjects.begin(), m_idfObjects.end(), pred);
-          if (spm_idf != m_idfObjects.end()) {
-            auto result = spm_idf->getString(SetpointManager_MixedAirFields::FanInletNodeName);
+          // The mixed air setpoint manager is registered in m_map when translated, so look it up by handle
+          // rather than scanning every IdfObject produced so far
+          auto it = m_map.find(spm.handle());
+          if (it != m_map.end()) {
+            IdfObject spm_idf = it->second;
+            auto result = spm_idf.getString(SetpointManager_MixedAirFields::FanInletNodeName);
             if (!result || result->empty()) {
-              spm_idf->setString(SetpointManager_MixedAirFields::FanInletNodeName, fanInletNodeName);
+              spm_idf.setString(SetpointManager_MixedAirFields::FanInletNodeName, fanInletNodeName);
             }
-            result = spm_idf->getString(SetpointManager_MixedAirFields::FanOutletNodeName);
+            result = spm_idf.getString(SetpointManager_MixedAirFields::FanOutletNodeName);
             if (!result || result->empty()) {
-              spm_idf->setString(SetpointManager_MixedAirFields::FanOutletNodeName, fanOutletNodeName);
+              spm_idf.setString(SetpointManager_MixedAirFields::FanOutletNodeName, fanOutletNodeName);
             }
           }
         }
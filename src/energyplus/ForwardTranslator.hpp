@@ -1468,6 +1468,10 @@ namespace energyplus {
     static std::vector<IddObjectType> iddObjectsToTranslate();
     static std::vector<IddObjectType> iddObjectsToTranslateInitializer();
 
+    /** Position of each IddObjectType in iddObjectsToTranslate(), computed once. Used to order and filter the
+   *  children of every ParentObject without copying and linearly searching the full type list per child. */
+    static const std::map<IddObjectType, size_t>& iddObjectsToTranslateOrder();
+
     /** Determines whether or not the HVACComponent is part of a unitary system or on an
    *  AirLoopHVAC */
     bool isHVACComponentWithinUnitary(const model::HVACComponent& hvacComponent) const;
@@ -114,3 +114,44 @@ TEST_F(EnergyPlusFixture, ErrorFile_WarningsAndCrash) {
   EXPECT_FALSE(errorFile.completed());
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
+
+TEST_F(EnergyPlusFixture, ErrorFile_RepeatingWarnings) {
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  ASSERT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  std::map<std::string, unsigned> warningCounts = errorFile.warningCounts();
+  EXPECT_EQ(static_cast<unsigned>(13), warningCounts.size());
+  unsigned total = 0;
+  for (const auto& warningCount : warningCounts) {
+    total += warningCount.second;
+  }
+  EXPECT_EQ(static_cast<unsigned>(52), total);
+  EXPECT_EQ(static_cast<unsigned>(13), warningCounts["SimHVAC: Maximum iterations (#) exceeded for all HVAC loops, at RUN PERIOD #, #/# #:# - #:#"]);
+
+  // parse the same file in small chunks, as when following the file while EnergyPlus is running
+  std::ifstream ifs(openstudio::toSystemFilename(path), std::ios_base::binary);
+  std::stringstream ss;
+  ss << ifs.rdbuf();
+  std::string text = ss.str();
+
+  unsigned numCallbacks = 0;
+  ErrorFile incremental([&numCallbacks](const openstudio::energyplus::ErrorLevel& level, const std::string& message) {
+    EXPECT_EQ(openstudio::energyplus::ErrorLevel::Warning, level.value());
+    EXPECT_FALSE(message.empty());
+    ++numCallbacks;
+  });
+  for (std::string::size_type i = 0; i < text.size(); i += 7) {
+    incremental.parseText(text.substr(i, 7));
+  }
+  incremental.finish();
+
+  EXPECT_EQ(static_cast<unsigned>(52), numCallbacks);
+  EXPECT_EQ(errorFile.warnings(), incremental.warnings());
+  EXPECT_EQ(errorFile.warningCounts(), incremental.warningCounts());
+  EXPECT_TRUE(incremental.completed());
+  EXPECT_TRUE(incremental.completedSuccessfully());
+}
@@ -719,7 +719,6 @@ namespace gbxml {
     // z-level not set, attempt to find it
     if (!zLevel) {
       for (const auto& space : story.spaces()) {
-        Transformation t = space.buildingTransformation();
         for (const auto& surface : space.surfaces()) {
           for (const auto& vertex : surface.vertices()) {
             if (zLevel) {
@@ -108,8 +108,10 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateScheduleWeek(const pugi::xml_node& element, const pugi::xml_node& root,
-                                                                                           openstudio::model::Model& model) {
+  boost::optional<openstudio::model::ModelObject>
+    ReverseTranslator::translateScheduleWeek(const pugi::xml_node& element,
+                                             const std::unordered_map<std::string, pugi::xml_node>& dayScheduleElements,
+                                             openstudio::model::Model& model) {
     std::string id = element.attribute("id").value();
     std::string type = element.attribute("type").value();
 
@@ -127,52 +129,48 @@ namespace gbxml {
       std::string dayType = dayElement.attribute("dayType").value();
       std::string dayScheduleIdRef = dayElement.attribute("dayScheduleIdRef").value();
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      for (auto& dayScheduleElement : root.children("DaySchedule")) {
-        std::string thisId = dayScheduleElement.attribute("id").value();
-        if (thisId == dayScheduleIdRef) {
-
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, model);
-          if (modelObject) {
-
-            boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
-            if (scheduleDay) {
-
-              if (dayType == "Weekday") {
-                result.setWeekdaySchedule(*scheduleDay);
-              } else if (dayType == "Weekend") {
-                result.setWeekendSchedule(*scheduleDay);
-              } else if (dayType == "Holiday") {
-                result.setHolidaySchedule(*scheduleDay);
-              } else if (dayType == "WeekendOrHoliday") {
-                result.setWeekendSchedule(*scheduleDay);
-                result.setHolidaySchedule(*scheduleDay);
-              } else if (dayType == "HeatingDesignDay") {
-                result.setWinterDesignDaySchedule(*scheduleDay);
-              } else if (dayType == "CoolingDesignDay") {
-                result.setSummerDesignDaySchedule(*scheduleDay);
-              } else if (dayType == "Sun") {
-                result.setSundaySchedule(*scheduleDay);
-              } else if (dayType == "Mon") {
-                result.setMondaySchedule(*scheduleDay);
-              } else if (dayType == "Tue") {
-                result.setTuesdaySchedule(*scheduleDay);
-              } else if (dayType == "Wed") {
-                result.setWednesdaySchedule(*scheduleDay);
-              } else if (dayType == "Thu") {
-                result.setThursdaySchedule(*scheduleDay);
-              } else if (dayType == "Fri") {
-                result.setFridaySchedule(*scheduleDay);
-              } else if (dayType == "Sat") {
-                result.setSaturdaySchedule(*scheduleDay);
-              } else {
-                // dayType can be "All"
-                result.setAllSchedules(*scheduleDay);
-              }
+      auto dayScheduleIt = dayScheduleElements.find(dayScheduleIdRef);
+      if (dayScheduleIt != dayScheduleElements.end()) {
+        const pugi::xml_node& dayScheduleElement = dayScheduleIt->second;
+
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, model);
+        if (modelObject) {
+
+          boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
+          if (scheduleDay) {
+
+            if (dayType == "Weekday") {
+              result.setWeekdaySchedule(*scheduleDay);
+            } else if (dayType == "Weekend") {
+              result.setWeekendSchedule(*scheduleDay);
+            } else if (dayType == "Holiday") {
+              result.setHolidaySchedule(*scheduleDay);
+            } else if (dayType == "WeekendOrHoliday") {
+              result.setWeekendSchedule(*scheduleDay);
+              result.setHolidaySchedule(*scheduleDay);
+            } else if (dayType == "HeatingDesignDay") {
+              result.setWinterDesignDaySchedule(*scheduleDay);
+            } else if (dayType == "CoolingDesignDay") {
+              result.setSummerDesignDaySchedule(*scheduleDay);
+            } else if (dayType == "Sun") {
+              result.setSundaySchedule(*scheduleDay);
+            } else if (dayType == "Mon") {
+              result.setMondaySchedule(*scheduleDay);
+            } else if (dayType == "Tue") {
+              result.setTuesdaySchedule(*scheduleDay);
+            } else if (dayType == "Wed") {
+              result.setWednesdaySchedule(*scheduleDay);
+            } else if (dayType == "Thu") {
+              result.setThursdaySchedule(*scheduleDay);
+            } else if (dayType == "Fri") {
+              result.setFridaySchedule(*scheduleDay);
+            } else if (dayType == "Sat") {
+              result.setSaturdaySchedule(*scheduleDay);
+            } else {
+              // dayType can be "All"
+              result.setAllSchedules(*scheduleDay);
             }
           }
-
-          break;
         }
       }
     }
@@ -180,8 +178,11 @@ namespace gbxml {
     return result;
   }
 
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateSchedule(const pugi::xml_node& element, const pugi::xml_node& root,
-                                                                                       openstudio::model::Model& model) {
+  boost::optional<openstudio::model::ModelObject>
+    ReverseTranslator::translateSchedule(const pugi::xml_node& element,
+                                         const std::unordered_map<std::string, pugi::xml_node>& weekScheduleElements,
+                                         const std::unordered_map<std::string, pugi::xml_node>& dayScheduleElements,
+                                         openstudio::model::Model& model) {
     std::string id = element.attribute("id").value();
     std::string type = element.attribute("type").value();
 
@@ -218,23 +219,19 @@ namespace gbxml {
       OS_ASSERT(yd.calendarYear().get() == std::stoi(endDateParts.at(0)));
       openstudio::Date endDate = yd.makeDate(std::stoi(endDateParts.at(1)), std::stoi(endDateParts.at(2)));
 
-      std::string weekScheduleId = element.child("WeekScheduleId").attribute("weekScheduleIdRef").value();
+      std::string weekScheduleId = scheduleYearElement.child("WeekScheduleId").attribute("weekScheduleIdRef").value();
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      for (auto& scheduleWeekElement : root.children("WeekSchedule")) {
-        std::string thisId = scheduleWeekElement.attribute("id").value();
-        if (thisId == weekScheduleId) {
+      auto scheduleWeekIt = weekScheduleElements.find(weekScheduleId);
+      if (scheduleWeekIt != weekScheduleElements.end()) {
+        const pugi::xml_node& scheduleWeekElement = scheduleWeekIt->second;
 
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, root, model);
-          if (modelObject) {
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, dayScheduleElements, model);
+        if (modelObject) {
 
-            boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
-            if (scheduleWeek) {
-              result.addScheduleWeek(endDate, *scheduleWeek);
-            }
+          boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
+          if (scheduleWeek) {
+            result.addScheduleWeek(endDate, *scheduleWeek);
           }
-
-          break;
         }
       }
     }
@@ -291,7 +291,18 @@ namespace gbxml {
       }
     }
 
-    // do schedules before loads
+    // do schedules before loads, week and day schedules are resolved by id so index them first
+    std::unordered_map<std::string, pugi::xml_node> weekScheduleElements;
+    for (auto& weekScheduleEl : root.children("WeekSchedule")) {
+      // first element with a given id wins
+      weekScheduleElements.emplace(weekScheduleEl.attribute("id").value(), weekScheduleEl);
+    }
+
+    std::unordered_map<std::string, pugi::xml_node> dayScheduleElements;
+    for (auto& dayScheduleEl : root.children("DaySchedule")) {
+      dayScheduleElements.emplace(dayScheduleEl.attribute("id").value(), dayScheduleEl);
+    }
+
     auto scheduleElements = root.children("Schedule");
     if (m_progressBar) {
       m_progressBar->setWindowTitle(toString("Translating Schedules"));
@@ -301,7 +312,7 @@ namespace gbxml {
     }
 
     for (auto& scheduleElement : scheduleElements) {
-      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, root, model);
+      boost::optional<model::ModelObject> schedule = translateSchedule(scheduleElement, weekScheduleElements, dayScheduleElements, model);
       OS_ASSERT(schedule);  // Krishnan, what type of error handling do you want?
 
       if (m_progressBar) {
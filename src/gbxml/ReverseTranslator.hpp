@@ -86,7 +86,7 @@ namespace gbxml {
     // given id and name from XML (name may be empty) return an OS name
     std::string escapeName(const std::string& id, const std::string& name);
 
-    std::map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
+    std::unordered_map<std::string, openstudio::model::ModelObject> m_idToObjectMap;
 
     // In ReverseTranslator.cpp
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
@@ -102,10 +102,12 @@ namespace gbxml {
 
     // In MapSchedules.cpp
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const pugi::xml_node& element, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateScheduleWeek(const pugi::xml_node& element, const pugi::xml_node& root,
-                                                                          openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateSchedule(const pugi::xml_node& element, const pugi::xml_node& root,
-                                                                      openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject>
+      translateScheduleWeek(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node>& dayScheduleElements,
+                            openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject>
+      translateSchedule(const pugi::xml_node& element, const std::unordered_map<std::string, pugi::xml_node>& weekScheduleElements,
+                        const std::unordered_map<std::string, pugi::xml_node>& dayScheduleElements, openstudio::model::Model& model);
 
     // In MapEnvelope.cpp
     boost::optional<openstudio::model::ModelObject> translateConstruction(const pugi::xml_node& element,
@@ -56,6 +56,12 @@
 #include "../../model/SubSurface_Impl.hpp"
 #include "../../model/StandardOpaqueMaterial.hpp"
 #include "../../model/StandardOpaqueMaterial_Impl.hpp"
+#include "../../model/ScheduleYear.hpp"
+#include "../../model/ScheduleYear_Impl.hpp"
+#include "../../model/ScheduleWeek.hpp"
+#include "../../model/ScheduleWeek_Impl.hpp"
+#include "../../model/ScheduleDay.hpp"
+#include "../../model/ScheduleDay_Impl.hpp"
 
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/core/Optional.hpp"
@@ -590,3 +596,54 @@ TEST_F(gbXMLFixture, ReverseTranslator_3997_WindowScaling) {
     EXPECT_EQ("Outdoors", _surf->outsideBoundaryCondition());
   }
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_Schedules) {
+  // each Schedule references a WeekSchedule by id inside its YearSchedule, which references a DaySchedule by id
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/TestCube.xml");
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> _model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(_model);
+
+  auto gbXMLId = [](const ModelObject& object) {
+    boost::optional<std::string> id = object.additionalProperties().getFeatureAsString("gbXMLId");
+    return id ? *id : std::string();
+  };
+
+  std::vector<ScheduleYear> scheduleYears = _model->getConcreteModelObjects<ScheduleYear>();
+  ASSERT_EQ(2u, scheduleYears.size());
+  std::map<std::string, std::pair<std::string, std::string>> expectedIds{{"aim0056", {"aim0054", "aim0053"}}, {"aim0062", {"aim0060", "aim0059"}}};
+  for (const ScheduleYear& scheduleYear : scheduleYears) {
+    auto expected = expectedIds.find(gbXMLId(scheduleYear));
+    ASSERT_NE(expectedIds.end(), expected);
+
+    std::vector<ScheduleWeek> scheduleWeeks = scheduleYear.scheduleWeeks();
+    ASSERT_EQ(1u, scheduleWeeks.size());
+    EXPECT_EQ(expected->second.first, gbXMLId(scheduleWeeks[0]));
+    boost::optional<ScheduleWeek> scheduleWeek = _model->getModelObjectByName<ScheduleWeek>(scheduleWeeks[0].nameString());
+    ASSERT_TRUE(scheduleWeek);
+    EXPECT_EQ(scheduleWeek->handle(), scheduleWeeks[0].handle());
+
+    // dayType is All
+    boost::optional<ScheduleDay> monday = scheduleWeeks[0].mondaySchedule();
+    boost::optional<ScheduleDay> sunday = scheduleWeeks[0].sundaySchedule();
+    ASSERT_TRUE(monday);
+    ASSERT_TRUE(sunday);
+    EXPECT_EQ(monday->handle(), sunday->handle());
+    EXPECT_EQ(expected->second.second, gbXMLId(*monday));
+    boost::optional<ScheduleDay> scheduleDay = _model->getModelObjectByName<ScheduleDay>(monday->nameString());
+    ASSERT_TRUE(scheduleDay);
+    EXPECT_EQ(scheduleDay->handle(), monday->handle());
+  }
+
+  // Office Lighting - 6 AM to 11 PM
+  boost::optional<ScheduleDay> lighting;
+  for (const ScheduleDay& scheduleDay : _model->getConcreteModelObjects<ScheduleDay>()) {
+    if (gbXMLId(scheduleDay) == "aim0053") {
+      lighting = scheduleDay;
+    }
+  }
+  ASSERT_TRUE(lighting);
+  EXPECT_DOUBLE_EQ(0.1, lighting->getValue(openstudio::Time(0, 6, 30)));
+  EXPECT_DOUBLE_EQ(0.9, lighting->getValue(openstudio::Time(0, 8, 30)));
+}
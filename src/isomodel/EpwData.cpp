@@ -30,6 +30,10 @@
 #include "EpwData.hpp"
 #include "SolarRadiation.hpp"
 
+#include "../utilities/filetypes/EpwFile.hpp"
+
+#include <algorithm>
+
 namespace openstudio {
 namespace isomodel {
 
@@ -37,65 +41,6 @@ namespace isomodel {
     loadData(t_path);
   }
 
-  void EpwData::parseHeader(const std::string& line) {
-    std::stringstream linestream(line);
-
-    //cout << "Weather Location Header: "<<endl;
-    for (int i = 0; i < 10; i++) {
-      std::string s;
-      std::getline(linestream, s, ',');
-      switch (i) {
-        case 1:
-          m_location = s;
-          //cout << "\tLocation: " << s <<endl;
-          break;
-        case 5:
-          m_stationid = s;
-          //cout << "\tStation ID: " << s <<endl;
-          break;
-        case 6:
-          m_latitude = atof(s.c_str());
-          //cout << "\tLatitude: " << s <<endl;
-          break;
-        case 7:
-          m_longitude = atof(s.c_str());
-          //cout << "\tLongitude: " << s <<endl;
-          break;
-        case 8:
-          m_timezone = atoi(s.c_str());
-          //cout << "\tTimezone: " << s <<endl;
-          break;
-        default:
-          break;
-      }
-    }
-  }
-
-  void EpwData::parseData(const std::string& line, size_t row) {
-    std::stringstream linestream(line);
-    size_t col = 0;
-
-    for (size_t i = 0; i < 22; i++) {
-      std::string s;
-      std::getline(linestream, s, ',');
-      switch (i) {
-        case 6:
-        case 7:
-        case 8:
-        case 13:
-        case 14:
-        case 15:
-        case 21:
-          assert(col < m_data.size());
-          assert(row < m_data[col].size());
-          m_data[col++][row] = ::atof(s.c_str());
-          break;
-        default:
-          break;
-      }
-    }
-  }
-
   void EpwData::toISOData(Matrix& _msolar, Matrix& _mhdbt, Matrix& _mhEgh, Vector& _mEgh, Vector& _mdbt, Vector& _mwind) const {
     struct MakeMatrix
     {
@@ -172,24 +117,31 @@ namespace isomodel {
 
   void EpwData::loadData(const openstudio::path& t_path) {
     // Array was fully initialized in constructor
-    std::ifstream myfile(openstudio::toSystemFilename(t_path));
-    if (myfile.is_open()) {
-      size_t i = 0;
-      size_t row = 0;
-      while (myfile.good() && row < 8760) {
-        i++;
-        std::string line;
-        getline(myfile, line);
-        if (i == 1) {
-          parseHeader(line);
-        } else if (i > 8) {
-          parseData(line, row++);
-        }
-      }
-      myfile.close();
-    } else {
+    boost::optional<EpwFile> epwFile = EpwFile::load(t_path, true);
+    if (!epwFile) {
       throw std::runtime_error("Unable to open weather file: " + openstudio::toString(t_path));
     }
+
+    m_location = epwFile->city();
+    m_stationid = epwFile->wmoNumber();
+    m_latitude = epwFile->latitude();
+    m_longitude = epwFile->longitude();
+    m_timezone = static_cast<int>(epwFile->timeZone());
+
+    // missing values keep the EPW missing marker, as they did when this class parsed the file itself
+    std::vector<EpwDataPoint> data = epwFile->data();
+    size_t numRows = std::min<size_t>(data.size(), 8760);
+    for (size_t row = 0; row < numRows; ++row) {
+      const EpwDataPoint& point = data[row];
+      m_data[DBT][row] = point.dryBulbTemperature().value_or(99.9);
+      m_data[DPT][row] = point.dewPointTemperature().value_or(99.9);
+      m_data[RH][row] = point.relativeHumidity().value_or(999);
+      m_data[EGH][row] = point.globalHorizontalRadiation().value_or(9999);
+      m_data[EB][row] = point.directNormalRadiation().value_or(9999);
+      m_data[ED][row] = point.diffuseHorizontalRadiation().value_or(9999);
+      m_data[WSPD][row] = point.windSpeed().value_or(999);
+    }
   }
+
 }  // namespace isomodel
 }  // namespace openstudio
@@ -29,6 +29,11 @@
 
 #include "SimModel.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
 #if _DEBUG || (__GNUC__ && !NDEBUG)
 #  define DEBUG_ISO_MODEL_SIMULATION
 #endif
@@ -2189,6 +2194,49 @@ end
                             v_Qcl_gas_tot, v_Q_dhw_gas, frac_hrs_wk_day);
   }
 
+  std::vector<ISOResults> SimModel::simulate(const std::vector<SimModel>& models, unsigned numThreads) {
+    std::vector<ISOResults> results(models.size());
+    if (models.empty()) {
+      return results;
+    }
+
+    if (numThreads == 0) {
+      numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, models.size()));
+
+    // each worker claims the next unsimulated model, results are written to disjoint slots
+    std::atomic<size_t> next(0);
+    std::exception_ptr error;
+    std::atomic<bool> failed(false);
+    auto worker = [&models, &results, &next, &error, &failed]() {
+      for (size_t i = next++; i < models.size() && !failed; i = next++) {
+        try {
+          results[i] = models[i].simulate();
+        } catch (...) {
+          if (!failed.exchange(true)) {
+            error = std::current_exception();
+          }
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (unsigned t = 1; t < numThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    if (error) {
+      std::rethrow_exception(error);
+    }
+    return results;
+  }
+
   ISOResults SimModel::outputGeneration(const Vector& v_Qelec_ht, const Vector& v_Qcl_elec_tot, const Vector& v_Q_illum_tot,
                                         const Vector& v_Q_illum_ext_tot, const Vector& v_Qfan_tot, const Vector& v_Q_pump_tot,
                                         const Vector& v_Q_dhw_elec, const Vector& v_Qgas_ht, const Vector& v_Qcl_gas_tot, const Vector& v_Q_dhw_gas,
@@ -113,6 +113,16 @@ namespace isomodel {
      *  returns ISOResults which is a vector of EndUses, one EndUses per month of the year
      */
     ISOResults simulate() const;
+
+    /*
+     *  Runs the ISO Model calculations for a batch of models, e.g. the variants of a parameter sweep.
+     *  Each model still runs the scalar simulate(), the batch only spreads the models across numThreads
+     *  worker threads (0 uses the hardware concurrency). Results are returned in the same order as the input
+     *  and are identical to calling simulate() on each model.
+     *  Models may share their Location (and hence weather data) since simulate() does not modify its inputs.
+     */
+    static std::vector<ISOResults> simulate(const std::vector<SimModel>& models, unsigned numThreads = 0);
+
     REGISTER_LOGGER("openstudio.isomodel.SimModel");
 
    private:
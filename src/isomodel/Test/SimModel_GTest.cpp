@@ -325,3 +325,39 @@ TEST_F(ISOModelFixture, SimModel) {
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[10].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
   EXPECT_DOUBLE_EQ(0, results.monthlyResults[11].getEndUse(EndUseFuelType::Gas, EndUseCategoryType::WaterSystems));
 }
+
+TEST_F(ISOModelFixture, SimModel_simulateBatch) {
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+
+  std::vector<SimModel> simModels;
+  for (int i = 0; i < 8; ++i) {
+    userModel.setCoolingSystemCOP(2.0 + 0.25 * i);
+    userModel.setLightingPowerIntensityOccupied(5.0 + i);
+    simModels.push_back(userModel.toSimModel());
+  }
+
+  std::vector<ISOResults> batchResults = SimModel::simulate(simModels, 3);
+  ASSERT_EQ(simModels.size(), batchResults.size());
+
+  std::vector<EndUseFuelType> fuelTypes = EndUses::fuelTypes();
+  std::vector<EndUseCategoryType> categories = EndUses::categories();
+  for (size_t i = 0; i < simModels.size(); ++i) {
+    ISOResults results = simModels[i].simulate();
+    ASSERT_EQ(results.monthlyResults.size(), batchResults[i].monthlyResults.size());
+    for (size_t month = 0; month < results.monthlyResults.size(); ++month) {
+      for (const auto& fuelType : fuelTypes) {
+        for (const auto& category : categories) {
+          EXPECT_EQ(results.monthlyResults[month].getEndUse(fuelType, category),
+                    batchResults[i].monthlyResults[month].getEndUse(fuelType, category));
+        }
+      }
+    }
+  }
+
+  // variants differ, so results must not have been mixed up between slots
+  EXPECT_NE(batchResults.front().totalEnergyUse(), batchResults.back().totalEnergyUse());
+
+  EXPECT_TRUE(SimModel::simulate(std::vector<SimModel>()).empty());
+}
@@ -35,6 +35,8 @@
 
 #include <resources.hxx>
 
+#include <algorithm>
+#include <ctime>
 #include <sstream>
 
 using namespace openstudio::isomodel;
@@ -1087,3 +1089,86 @@ TEST_F(ISOModelFixture, UserModel) {
     EXPECT_DOUBLE_EQ(mwindExp[v], mwind[r]);
   }
 }
+
+TEST_F(ISOModelFixture, UserModel_WeatherCache) {
+  // private copy of the weather file, last written an hour ago so cache entries are trusted
+  openstudio::path weatherPath = openstudio::filesystem::system_complete(openstudio::toPath("./UserModel_WeatherCache.epw"));
+  openstudio::filesystem::copy_file(resourcesPath() / openstudio::toPath("isomodel/weather.epw"), weatherPath,
+                                    openstudio::filesystem::copy_option::overwrite_if_exists);
+  std::time_t writeTime = std::time(nullptr) - 3600;
+  openstudio::filesystem::last_write_time(weatherPath, writeTime);
+
+  UserModel userModel;
+  userModel.load(resourcesPath() / openstudio::toPath("isomodel/exampleModel.ISO"));
+  ASSERT_TRUE(userModel.valid());
+  userModel.setWeatherFilePath(weatherPath);
+  std::shared_ptr<WeatherData> weather1 = userModel.loadWeather();
+  ASSERT_TRUE(weather1);
+
+  // change every dry bulb temperature without changing the size of the file, then restore its last write time
+  {
+    std::string contents;
+    {
+      openstudio::filesystem::ifstream file(weatherPath, std::ios_base::binary);
+      ASSERT_TRUE(file.is_open());
+      std::stringstream ss;
+      ss << file.rdbuf();
+      contents = ss.str();
+    }
+
+    std::istringstream lines(contents);
+    std::string line;
+    std::string modified;
+    unsigned lineNum = 0;
+    while (std::getline(lines, line)) {
+      // data starts after the 8 header lines, dry bulb temperature is the seventh field
+      if (lineNum++ >= 8) {
+        size_t begin = 0;
+        for (unsigned i = 0; i < 6; ++i) {
+          begin = line.find(',', begin) + 1;
+        }
+        size_t end = line.find(',', begin);
+        std::replace(line.begin() + begin, line.begin() + end, '1', '2');
+      }
+      modified += line + '\n';
+    }
+    ASSERT_EQ(contents.size(), modified.size());
+    ASSERT_NE(contents, modified);
+
+    openstudio::filesystem::ofstream file(weatherPath, std::ios_base::binary | std::ios_base::trunc);
+    ASSERT_TRUE(file.is_open());
+    file << modified;
+    file.close();
+    openstudio::filesystem::last_write_time(weatherPath, writeTime);
+  }
+
+  // same path, size and last write time, so the checksum of the original file and its aggregates are served from the cache
+  std::shared_ptr<WeatherData> weather2 = userModel.loadWeather();
+  ASSERT_TRUE(weather2);
+  EXPECT_NE(weather1.get(), weather2.get());
+  ASSERT_EQ(weather1->mdbt().size(), weather2->mdbt().size());
+  for (unsigned i = 0; i < weather1->mdbt().size(); ++i) {
+    EXPECT_EQ(weather1->mdbt()[i], weather2->mdbt()[i]);
+    EXPECT_EQ(weather1->mEgh()[i], weather2->mEgh()[i]);
+    EXPECT_EQ(weather1->mwind()[i], weather2->mwind()[i]);
+  }
+  ASSERT_EQ(weather1->msolar().size2(), weather2->msolar().size2());
+  for (unsigned i = 0; i < weather1->msolar().size1(); ++i) {
+    for (unsigned j = 0; j < weather1->msolar().size2(); ++j) {
+      EXPECT_EQ(weather1->msolar()(i, j), weather2->msolar()(i, j));
+    }
+  }
+
+  // a new last write time invalidates the entry and the modified file is read
+  openstudio::filesystem::last_write_time(weatherPath, writeTime + 60);
+  std::shared_ptr<WeatherData> weather3 = userModel.loadWeather();
+  ASSERT_TRUE(weather3);
+  ASSERT_EQ(weather1->mdbt().size(), weather3->mdbt().size());
+  bool changed = false;
+  for (unsigned i = 0; i < weather1->mdbt().size(); ++i) {
+    changed = changed || (weather1->mdbt()[i] != weather3->mdbt()[i]);
+  }
+  EXPECT_TRUE(changed);
+
+  openstudio::filesystem::remove(weatherPath);
+}
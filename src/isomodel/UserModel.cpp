@@ -29,10 +29,29 @@
 
 #include "UserModel.hpp"
 
+#include "../utilities/core/Checksum.hpp"
+#include "../utilities/core/FileContentCache.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
 using namespace std;
 namespace openstudio {
 namespace isomodel {
 
+  namespace {
+
+    /// checksums of the weather files loaded in this process
+    FileContentCache<std::string> weatherChecksumCache;
+
+    std::mutex weatherCacheMutex;
+
+    /// ISO weather aggregates of each weather file loaded in this process, keyed by the checksum of the file, so
+    /// copies of one weather file in different directories are only parsed and binned once
+    std::unordered_map<std::string, std::shared_ptr<const WeatherData>> weatherCache;
+
+  }  // namespace
+
   SimModel UserModel::toSimModel() {
     _valid = true;
     if (!_weather) {
@@ -605,6 +624,17 @@ namespace isomodel {
         return std::shared_ptr<WeatherData>();
       }
     }
+    // ISO weather aggregates depend only on the contents of the weather file, share them between all models loaded in
+    // this process; each model gets its own copy since WeatherData is mutable through Location
+    std::string checksum = weatherChecksumCache.get(weatherFilename, [](const openstudio::path& path) { return openstudio::checksum(path); }).get();
+    {
+      std::lock_guard<std::mutex> lock(weatherCacheMutex);
+      auto it = weatherCache.find(checksum);
+      if (it != weatherCache.end()) {
+        return std::make_shared<WeatherData>(*it->second);
+      }
+    }
+
     EpwData edata(weatherFilename);
 
     Matrix _msolar(12, 8, 0);
@@ -624,6 +654,11 @@ namespace isomodel {
     wdata->setMsolar(_msolar);
     wdata->setMwind(_mwind);
 
+    {
+      std::lock_guard<std::mutex> lock(weatherCacheMutex);
+      weatherCache[checksum] = std::make_shared<const WeatherData>(*wdata);
+    }
+
     return wdata;
   }
 
@@ -77,6 +77,65 @@ namespace model {
       return evaluate(values);
     }
 
+    std::vector<double> Curve_Impl::evaluate(const std::vector<std::vector<double>>& x) const {
+      CurveEvaluationStatistics statistics;
+      return evaluate(x, statistics);
+    }
+
+    std::vector<double> Curve_Impl::evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& /*statistics*/) const {
+      std::vector<double> result;
+      result.reserve(x.size());
+      for (const auto& point : x) {
+        result.push_back(evaluate(point));
+      }
+      return result;
+    }
+
+    double Curve_Impl::clampValue(double value, double minimum, double maximum, unsigned& numClamped) {
+      // same order of checks as evaluate, so results are identical
+      bool clamped = false;
+      if (value < minimum) {
+        value = minimum;
+        clamped = true;
+      }
+      if (value > maximum) {
+        value = maximum;
+        clamped = true;
+      }
+      if (clamped) {
+        ++numClamped;
+      }
+      return value;
+    }
+
+    double Curve_Impl::clampValue(double value, const boost::optional<double>& minimum, const boost::optional<double>& maximum,
+                                  unsigned& numClamped) {
+      bool clamped = false;
+      if (minimum && (value < minimum.get())) {
+        value = minimum.get();
+        clamped = true;
+      }
+      if (maximum && (value > maximum.get())) {
+        value = maximum.get();
+        clamped = true;
+      }
+      if (clamped) {
+        ++numClamped;
+      }
+      return value;
+    }
+
+    void Curve_Impl::warnClampedValues(unsigned numInputsClamped, unsigned numOutputsClamped, size_t numPoints) const {
+      if (numInputsClamped > 0) {
+        LOG(Warn, "Evaluating " << briefDescription() << " at " << numPoints << " points, " << numInputsClamped
+                                << " supplied values were outside of the minimum and maximum values and were reset.");
+      }
+      if (numOutputsClamped > 0) {
+        LOG(Warn, "Evaluating " << briefDescription() << " at " << numPoints << " points, " << numOutputsClamped
+                                << " calculated curve outputs were outside of the minimum and maximum curve output and were reset.");
+      }
+    }
+
     std::vector<EMSActuatorNames> Curve_Impl::emsActuatorNames() const {
       std::vector<EMSActuatorNames> actuators{{"Curve", "Curve Result"}};
       return actuators;
@@ -108,6 +167,14 @@ namespace model {
     return getImpl<detail::Curve_Impl>()->evaluate(x, y, z);
   }
 
+  std::vector<double> Curve::evaluate(const std::vector<std::vector<double>>& x) const {
+    return getImpl<detail::Curve_Impl>()->evaluate(x);
+  }
+
+  std::vector<double> Curve::evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const {
+    return getImpl<detail::Curve_Impl>()->evaluate(x, statistics);
+  }
+
   /// @cond
   Curve::Curve(IddObjectType type, const Model& model) : ResourceObject(type, model) {
     OS_ASSERT(getImpl<detail::Curve_Impl>());
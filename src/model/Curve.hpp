@@ -42,6 +42,15 @@ namespace model {
 
   }  // namespace detail
 
+  /** Counts of the values that a batch Curve::evaluate reset to the curve limits. */
+  struct MODEL_API CurveEvaluationStatistics
+  {
+    /** Number of supplied values that were outside of the minimum and maximum values and were reset. */
+    unsigned numInputsReset = 0;
+    /** Number of calculated curve outputs that were outside of the minimum and maximum curve output and were reset. */
+    unsigned numOutputsReset = 0;
+  };
+
   /** Curve is a ModelObject that serves as a base class for a number of specific types of curves,
  *  each of which is a function of one, two, or three variables. Curve requires its derived
  *  classes to implement numVariables and evaluate. For examples of objects that use \link Curve
@@ -75,6 +84,16 @@ namespace model {
     /** Convenience overload that throws if numVariables() != 3. */
     double evaluate(double x, double y, double z) const;
 
+    /** Returns the value of this Curve at each point of x, each point holding numVariables() values.
+   *  Inputs and outputs are limited exactly as in evaluate, but polynomial curves read their coefficients
+   *  and limits once per call and log a single warning summarizing the number of values that were reset. */
+    std::vector<double> evaluate(const std::vector<std::vector<double>>& x) const;
+
+    /** Same as the batch evaluate above, and adds the number of values that were reset to statistics. Curves that do
+   *  not implement a batch evaluate (all but the polynomial curves and TableMultiVariableLookup) evaluate each point
+   *  on its own, log each reset as evaluate does and leave statistics unchanged. */
+    std::vector<double> evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const;
+
     //@}
    protected:
     /// @cond
@@ -126,6 +126,44 @@ namespace model {
       return result;
     }
 
+    std::vector<double> CurveBicubic_Impl::evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                                    CurveEvaluationStatistics& statistics) const {
+      // read coefficients and limits once for the whole batch
+      const double c1 = coefficient1Constant();
+      const double c2 = coefficient2x();
+      const double c3 = coefficient3xPOW2();
+      const double c4 = coefficient4y();
+      const double c5 = coefficient5yPOW2();
+      const double c6 = coefficient6xTIMESY();
+      const double c7 = coefficient7xPOW3();
+      const double c8 = coefficient8yPOW3();
+      const double c9 = coefficient9xPOW2TIMESY();
+      const double c10 = coefficient10xTIMESYPOW2();
+
+      auto formula = [&](const std::vector<double>& point) {
+        const double x = point[0];
+        const double y = point[1];
+
+        double result = c1;
+        double x2 = pow(x, 2);
+        double y2 = pow(y, 2);
+        result += c2 * x;
+        result += c3 * x2;
+        result += c4 * y;
+        result += c5 * y2;
+        result += c6 * x * y;
+        result += c7 * pow(x, 3);
+        result += c8 * pow(y, 3);
+        result += c9 * x2 * y;
+        result += c10 * x * y2;
+
+        return result;
+      };
+
+      return evaluateBatch(independentVariables, {minimumValueofx(), minimumValueofy()}, {maximumValueofx(), maximumValueofy()}, minimumCurveOutput(),
+                           maximumCurveOutput(), formula, statistics);
+    }
+
     double CurveBicubic_Impl::coefficient1Constant() const {
       boost::optional<double> value = getDouble(OS_Curve_BicubicFields::Coefficient1Constant, true);
       OS_ASSERT(value);
@@ -65,6 +65,9 @@ namespace model {
 
       virtual double evaluate(const std::vector<double>& independentVariables) const override;
 
+      virtual std::vector<double> evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                           CurveEvaluationStatistics& statistics) const override;
+
       //@}
       /** @name Getters */
       //@{
@@ -122,6 +122,34 @@ namespace model {
       return result;
     }
 
+    std::vector<double> CurveBiquadratic_Impl::evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                                        CurveEvaluationStatistics& statistics) const {
+      // read coefficients and limits once for the whole batch
+      const double c1 = coefficient1Constant();
+      const double c2 = coefficient2x();
+      const double c3 = coefficient3xPOW2();
+      const double c4 = coefficient4y();
+      const double c5 = coefficient5yPOW2();
+      const double c6 = coefficient6xTIMESY();
+
+      auto formula = [&](const std::vector<double>& point) {
+        const double x = point[0];
+        const double y = point[1];
+
+        double result = c1;
+        result += c2 * x;
+        result += c3 * pow(x, 2);
+        result += c4 * y;
+        result += c5 * pow(y, 2);
+        result += c6 * x * y;
+
+        return result;
+      };
+
+      return evaluateBatch(independentVariables, {minimumValueofx(), minimumValueofy()}, {maximumValueofx(), maximumValueofy()}, minimumCurveOutput(),
+                           maximumCurveOutput(), formula, statistics);
+    }
+
     double CurveBiquadratic_Impl::coefficient1Constant() const {
       boost::optional<double> value = getDouble(OS_Curve_BiquadraticFields::Coefficient1Constant, true);
       OS_ASSERT(value);
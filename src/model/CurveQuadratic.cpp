@@ -108,6 +108,27 @@ namespace model {
       return result;
     }
 
+    std::vector<double> CurveQuadratic_Impl::evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                                      CurveEvaluationStatistics& statistics) const {
+      // read coefficients and limits once for the whole batch
+      const double c1 = coefficient1Constant();
+      const double c2 = coefficient2x();
+      const double c3 = coefficient3xPOW2();
+
+      auto formula = [&](const std::vector<double>& point) {
+        const double x = point[0];
+
+        double result = c1;
+        result += c2 * x;
+        result += c3 * pow(x, 2);
+
+        return result;
+      };
+
+      return evaluateBatch(independentVariables, {minimumValueofx()}, {maximumValueofx()}, minimumCurveOutput(), maximumCurveOutput(), formula,
+                           statistics);
+    }
+
     double CurveQuadratic_Impl::coefficient1Constant() const {
       boost::optional<double> value = getDouble(OS_Curve_QuadraticFields::Coefficient1Constant, true);
       OS_ASSERT(value);
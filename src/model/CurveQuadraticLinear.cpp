@@ -124,6 +124,36 @@ namespace model {
       return result;
     }
 
+    std::vector<double> CurveQuadraticLinear_Impl::evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                                            CurveEvaluationStatistics& statistics) const {
+      // read coefficients and limits once for the whole batch
+      const double c1 = coefficient1Constant();
+      const double c2 = coefficient2x();
+      const double c3 = coefficient3xPOW2();
+      const double c4 = coefficient4y();
+      const double c5 = coefficient5xTIMESY();
+      const double c6 = coefficient6xPOW2TIMESY();
+
+      auto formula = [&](const std::vector<double>& point) {
+        const double x = point[0];
+        const double y = point[1];
+
+        double x2 = pow(x, 2);
+        double result = c1;
+        result += c2 * x;
+        result += c3 * x2;
+        double temp = c4;
+        temp += c5 * x;
+        temp += c6 * x2;
+        result += temp * y;
+
+        return result;
+      };
+
+      return evaluateBatch(independentVariables, {minimumValueofx(), minimumValueofy()}, {maximumValueofx(), maximumValueofy()}, minimumCurveOutput(),
+                           maximumCurveOutput(), formula, statistics);
+    }
+
     double CurveQuadraticLinear_Impl::coefficient1Constant() const {
       boost::optional<double> value = getDouble(OS_Curve_QuadraticLinearFields::Coefficient1Constant, true);
       OS_ASSERT(value);
@@ -108,6 +108,31 @@ namespace model {
       return result;
     }
 
+    std::vector<double> CurveQuartic_Impl::evaluate(const std::vector<std::vector<double>>& independentVariables,
+                                                    CurveEvaluationStatistics& statistics) const {
+      // read coefficients and limits once for the whole batch
+      const double c1 = coefficient1Constant();
+      const double c2 = coefficient2x();
+      const double c3 = coefficient3xPOW2();
+      const double c4 = coefficient4xPOW3();
+      const double c5 = coefficient5xPOW4();
+
+      auto formula = [&](const std::vector<double>& point) {
+        const double x = point[0];
+
+        double result = c1;
+        result += c2 * x;
+        result += c3 * pow(x, 2);
+        result += c4 * pow(x, 3);
+        result += c5 * pow(x, 4);
+
+        return result;
+      };
+
+      return evaluateBatch(independentVariables, {minimumValueofx()}, {maximumValueofx()}, minimumCurveOutput(), maximumCurveOutput(), formula,
+                           statistics);
+    }
+
     double CurveQuartic_Impl::coefficient1Constant() const {
       boost::optional<double> value = getDouble(OS_Curve_QuarticFields::Coefficient1Constant, true);
       OS_ASSERT(value);
@@ -32,6 +32,9 @@
 
 #include "ModelAPI.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "Curve.hpp"
+
+#include "../utilities/core/Assert.hpp"
 
 namespace openstudio {
 namespace model {
@@ -82,7 +85,54 @@ namespace model {
 
       double evaluate(double x, double y, double z) const;
 
+      std::vector<double> evaluate(const std::vector<std::vector<double>>& x) const;
+
+      /** Evaluates the curve at each point of x, adding the number of reset values to statistics. The default implementation
+       *  calls evaluate for every point, subclasses override it to read their coefficients and limits once for the whole batch. */
+      virtual std::vector<double> evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const;
+
       //@}
+     protected:
+      /** Shared loop of the batch evaluate overrides. Evaluates formula at each point of x, with each input reset to
+       *  [minimumValues[i], maximumValues[i]] and each output to [minimumOutput, maximumOutput] in the same order as evaluate,
+       *  then adds the number of reset values to statistics and logs a single warning summarizing them. */
+      template <typename Formula>
+      std::vector<double> evaluateBatch(const std::vector<std::vector<double>>& x, const std::vector<double>& minimumValues,
+                                        const std::vector<double>& maximumValues, const boost::optional<double>& minimumOutput,
+                                        const boost::optional<double>& maximumOutput, Formula formula,
+                                        CurveEvaluationStatistics& statistics) const {
+        const size_t numValues = minimumValues.size();
+        OS_ASSERT(maximumValues.size() == numValues);
+
+        unsigned numInputsClamped = 0;
+        unsigned numOutputsClamped = 0;
+        std::vector<double> point(numValues);
+        std::vector<double> results;
+        results.reserve(x.size());
+        for (const auto& values : x) {
+          OS_ASSERT(values.size() == numValues);
+          for (size_t i = 0; i < numValues; ++i) {
+            point[i] = clampValue(values[i], minimumValues[i], maximumValues[i], numInputsClamped);
+          }
+          results.push_back(clampValue(formula(point), minimumOutput, maximumOutput, numOutputsClamped));
+        }
+
+        statistics.numInputsReset += numInputsClamped;
+        statistics.numOutputsReset += numOutputsClamped;
+        warnClampedValues(numInputsClamped, numOutputsClamped, x.size());
+
+        return results;
+      }
+
+      /** Returns value reset to minimum or maximum if it lies outside of them, incrementing numClamped if so. */
+      static double clampValue(double value, double minimum, double maximum, unsigned& numClamped);
+
+      static double clampValue(double value, const boost::optional<double>& minimum, const boost::optional<double>& maximum,
+                               unsigned& numClamped);
+
+      /** Logs a single warning for a batch evaluation in which inputs or outputs were reset to their limits. */
+      void warnClampedValues(unsigned numInputsClamped, unsigned numOutputsClamped, size_t numPoints) const;
+
      private:
       REGISTER_LOGGER("openstudio.model.Curve");
     };
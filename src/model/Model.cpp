@@ -46,6 +46,7 @@
 #include <utilities/idd/OS_Version_FieldEnums.hxx>
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 #include "../utilities/core/PathHelpers.hpp"
 
 #include "../utilities/idd/IddEnums.hpp"
@@ -64,6 +65,9 @@
 
 #include <boost/regex.hpp>
 
+#include <set>
+#include <unordered_map>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -760,12 +764,102 @@ namespace model {
     }
 
     std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
+      // A resource is used if a non-resource object that is not one of its children points to it,
+      // or if a used resource points to it. This is the same rule as nonResourceObjectUseCount(true) > 0,
+      // but evaluated as a mark and sweep over the pointer graph, so that shared chains of
+      // resources are only visited once per pass.
       ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
+      std::unordered_map<const WorkspaceObject_Impl*, size_t> resourceIndices;
+      resourceIndices.reserve(resources.size());
+      for (size_t i = 0; i < resources.size(); ++i) {
+        resourceIndices.insert(std::make_pair(resources[i].getImpl<WorkspaceObject_Impl>().get(), i));
+      }
+
+      // non-resource objects that point to each resource and are not its children, and resources it points to
+      std::vector<HandleVector> users(resources.size());
+      std::vector<std::vector<size_t>> resourceTargets(resources.size());
+      for (size_t i = 0; i < resources.size(); ++i) {
+        boost::optional<ModelObjectVector> children;
+        for (const WorkspaceObject& source : resources[i].sources()) {
+          if (resourceIndices.find(source.getImpl<WorkspaceObject_Impl>().get()) != resourceIndices.end()) {
+            continue;
+          }
+          if (!children) {
+            children = resources[i].children();
+          }
+          auto it = std::find_if(children->begin(), children->end(),
+                                 std::bind(handleEquals<ModelObject, Handle>, std::placeholders::_1, source.handle()));
+          if (it == children->end()) {
+            users[i].push_back(source.handle());
+          }
+        }
+        for (const WorkspaceObject& target : resources[i].targets()) {
+          auto it = resourceIndices.find(target.getImpl<WorkspaceObject_Impl>().get());
+          if (it != resourceIndices.end()) {
+            resourceTargets[i].push_back(it->second);
+          }
+        }
+      }
+
+      // A user that is itself removed with an unused resource (e.g. the ScheduleRule of an unused ScheduleRuleset,
+      // which points to its ScheduleDay) does not keep anything in use. Removing more users can only leave more
+      // resources unused, so mark until the set of removed users stops growing.
+      std::vector<bool> used;
+      std::vector<boost::optional<ModelObjectVector>> recursiveChildren(resources.size());
+      std::set<Handle> removedUsers;
+      while (true) {
+        // mark: start from resources with users that are not removed
+        used.assign(resources.size(), false);
+        std::vector<size_t> toVisit;
+        for (size_t i = 0; i < resources.size(); ++i) {
+          for (const Handle& user : users[i]) {
+            if (removedUsers.find(user) == removedUsers.end()) {
+              used[i] = true;
+              toVisit.push_back(i);
+              break;
+            }
+          }
+        }
+
+        // then propagate along resource -> resource pointers
+        while (!toVisit.empty()) {
+          size_t i = toVisit.back();
+          toVisit.pop_back();
+          for (size_t j : resourceTargets[i]) {
+            if (!used[j]) {
+              used[j] = true;
+              toVisit.push_back(j);
+            }
+          }
+        }
+
+        size_t numRemovedUsers = removedUsers.size();
+        for (size_t i = 0; i < resources.size(); ++i) {
+          if (used[i]) {
+            continue;
+          }
+          if (!recursiveChildren[i]) {
+            recursiveChildren[i] = getRecursiveChildren(resources[i], true, false);
+          }
+          for (const ModelObject& object : *recursiveChildren[i]) {
+            if (resourceIndices.find(object.getImpl<WorkspaceObject_Impl>().get()) == resourceIndices.end()) {
+              removedUsers.insert(object.handle());
+            }
+          }
+        }
+        if (removedUsers.size() == numRemovedUsers) {
+          break;
+        }
+      }
+
+      // sweep: each unused resource is removed through its own remove(), so type specific overrides still apply
+      // (ExternalFile also deletes its file, SpaceLoadDefinition removes its instances, ...), and at Final strictness
+      // a removal that would invalidate the model only keeps that resource rather than the whole purge
       IdfObjectVector removedObjects;
-      for (ResourceObject& resource : resources) {
+      for (size_t i = 0; i < resources.size(); ++i) {
         // test for initialized first in case earlier .remove() got this one already
-        if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-          IdfObjectVector thisCallRemoved = resource.remove();
+        if (!used[i] && resources[i].initialized()) {
+          IdfObjectVector thisCallRemoved = resources[i].remove();
           removedObjects.insert(removedObjects.end(), thisCallRemoved.begin(), thisCallRemoved.end());
         }
       }
@@ -17,6 +17,9 @@
 
 // ignore specific overload of ThreeJSForwardTranslator::modelToThreeJS to avoid dealing with std::function<void(double)>updatePercentage
 %ignore openstudio::model::ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
+// ignore the std::ostream overloads
+%ignore openstudio::model::ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::ostream& os);
+%ignore openstudio::model::ThreeJSForwardTranslator::modelToThreeJSBinary;
 
 // All base classes for PV, Generators, inverters and Electrical Storage
 %{
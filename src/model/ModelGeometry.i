@@ -72,6 +72,9 @@
 %ignore openstudio::model::Space::getDefaultConstructionWithSearchDistance;
 %ignore openstudio::model::PlanarSurface::constructionWithSearchDistance;
 
+// No wrapped type for a vector of triangulations, use triangulation() on each surface
+%ignore openstudio::model::PlanarSurface::triangulations;
+
 namespace openstudio {
 namespace model {
 
@@ -76,6 +76,32 @@ using boost::to_upper_copy;
 namespace openstudio {
 namespace model {
 
+  // transforms vertices and holes to the reversed face coordinates required by computeTriangulation
+  static void toTriangulationFace(const Transformation& faceTransformationInverse, const std::vector<Point3d>& vertices,
+                                  const std::vector<std::vector<Point3d>>& holes, std::vector<Point3d>& faceVertices,
+                                  std::vector<std::vector<Point3d>>& faceHoles) {
+    faceVertices = faceTransformationInverse * vertices;
+    std::reverse(faceVertices.begin(), faceVertices.end());
+
+    faceHoles.clear();
+    for (const std::vector<Point3d>& hole : holes) {
+      std::vector<Point3d> holeVertices = faceTransformationInverse * hole;
+      std::reverse(holeVertices.begin(), holeVertices.end());
+      faceHoles.push_back(holeVertices);
+    }
+  }
+
+  static std::vector<std::vector<Point3d>> fromTriangulationFace(const Transformation& faceTransformation,
+                                                                 const std::vector<std::vector<Point3d>>& faceTriangulation) {
+    std::vector<std::vector<Point3d>> result;
+    result.reserve(faceTriangulation.size());
+    for (std::vector<Point3d> faceTriangle : faceTriangulation) {
+      std::reverse(faceTriangle.begin(), faceTriangle.end());
+      result.push_back(faceTransformation * faceTriangle);
+    }
+    return result;
+  }
+
   namespace detail {
 
     // constructor
@@ -517,33 +543,47 @@ namespace model {
     }
 
     std::vector<std::vector<Point3d>> PlanarSurface_Impl::triangulation() const {
-      if (m_cachedTriangulation.empty()) {
-        Transformation faceTransformation = Transformation::alignFace(this->vertices());
-        Transformation faceTransformationInverse = faceTransformation.inverse();
-
-        std::vector<Point3d> faceVertices = faceTransformationInverse * this->vertices();
-        std::reverse(faceVertices.begin(), faceVertices.end());
-
-        std::vector<std::vector<Point3d>> faceHoles;
-        for (const ModelObject& child : this->children()) {
-          OptionalPlanarSurface surface = child.optionalCast<PlanarSurface>();
-          if (surface) {
-            if (surface->subtractFromGrossArea()) {
-              std::vector<Point3d> holeVertices = faceTransformationInverse * surface->vertices();
-              std::reverse(holeVertices.begin(), holeVertices.end());
-              faceHoles.push_back(holeVertices);
-            }
-          }
-        }
+      std::vector<std::vector<Point3d>> holes = triangulationHoles();
+      if (boost::optional<std::vector<std::vector<Point3d>>> cached = cachedTriangulation(holes)) {
+        return *cached;
+      }
+
+      Transformation faceTransformation = Transformation::alignFace(this->vertices());
+      std::vector<Point3d> faceVertices;
+      std::vector<std::vector<Point3d>> faceHoles;
+      toTriangulationFace(faceTransformation.inverse(), this->vertices(), holes, faceVertices, faceHoles);
 
-        std::vector<std::vector<Point3d>> faceTriangulation = computeTriangulation(faceVertices, faceHoles);
+      std::vector<std::vector<Point3d>> result = fromTriangulationFace(faceTransformation, computeTriangulation(faceVertices, faceHoles));
+      setCachedTriangulation(holes, result);
+      return result;
+    }
 
-        for (std::vector<Point3d> faceTriangle : faceTriangulation) {
-          std::reverse(faceTriangle.begin(), faceTriangle.end());
-          m_cachedTriangulation.push_back(faceTransformation * faceTriangle);
+    std::vector<std::vector<Point3d>> PlanarSurface_Impl::triangulationHoles() const {
+      std::vector<std::vector<Point3d>> result;
+      for (const ModelObject& child : this->children()) {
+        OptionalPlanarSurface surface = child.optionalCast<PlanarSurface>();
+        if (surface) {
+          if (surface->subtractFromGrossArea()) {
+            result.push_back(surface->vertices());
+          }
         }
       }
-      return m_cachedTriangulation;
+      return result;
+    }
+
+    boost::optional<std::vector<std::vector<Point3d>>>
+      PlanarSurface_Impl::cachedTriangulation(const std::vector<std::vector<Point3d>>& holes) const {
+      // own vertex changes clear the cache, sub surface changes show up as different holes
+      if (m_cachedTriangulation && (m_cachedTriangulationHoles == holes)) {
+        return m_cachedTriangulation;
+      }
+      return boost::none;
+    }
+
+    void PlanarSurface_Impl::setCachedTriangulation(const std::vector<std::vector<Point3d>>& holes,
+                                                    const std::vector<std::vector<Point3d>>& triangulation) const {
+      m_cachedTriangulationHoles = holes;
+      m_cachedTriangulation = triangulation;
     }
 
     Point3d PlanarSurface_Impl::centroid() const {
@@ -602,7 +642,8 @@ namespace model {
       m_cachedVertices.reset();
       m_cachedPlane.reset();
       m_cachedOutwardNormal.reset();
-      m_cachedTriangulation.clear();
+      m_cachedTriangulation.reset();
+      m_cachedTriangulationHoles.clear();
     }
 
     bool PlanarSurface_Impl::setConstructionAsModelObject(boost::optional<ModelObject> modelObject) {
@@ -766,6 +807,44 @@ namespace model {
     return getImpl<detail::PlanarSurface_Impl>()->triangulation();
   }
 
+  std::vector<std::vector<std::vector<Point3d>>> PlanarSurface::triangulations(const std::vector<PlanarSurface>& planarSurfaces,
+                                                                                unsigned numThreads) {
+    std::vector<std::vector<std::vector<Point3d>>> result(planarSurfaces.size());
+
+    // model access is not thread safe, gather inputs and store results on this thread and only triangulate in parallel
+    std::vector<size_t> indices;
+    std::vector<std::vector<std::vector<Point3d>>> allHoles;
+    std::vector<Transformation> faceTransformations;
+    std::vector<std::vector<Point3d>> allFaceVertices;
+    std::vector<std::vector<std::vector<Point3d>>> allFaceHoles;
+    for (size_t i = 0; i < planarSurfaces.size(); ++i) {
+      std::shared_ptr<detail::PlanarSurface_Impl> impl = planarSurfaces[i].getImpl<detail::PlanarSurface_Impl>();
+      std::vector<std::vector<Point3d>> holes = impl->triangulationHoles();
+      if (boost::optional<std::vector<std::vector<Point3d>>> cached = impl->cachedTriangulation(holes)) {
+        result[i] = *cached;
+        continue;
+      }
+
+      std::vector<Point3d> vertices = impl->vertices();
+      faceTransformations.push_back(Transformation::alignFace(vertices));
+      allFaceVertices.emplace_back();
+      allFaceHoles.emplace_back();
+      toTriangulationFace(faceTransformations.back().inverse(), vertices, holes, allFaceVertices.back(), allFaceHoles.back());
+      allHoles.push_back(std::move(holes));
+      indices.push_back(i);
+    }
+
+    std::vector<std::vector<std::vector<Point3d>>> faceTriangulations = computeTriangulations(allFaceVertices, allFaceHoles, 0.001, numThreads);
+
+    for (size_t j = 0; j < indices.size(); ++j) {
+      size_t i = indices[j];
+      result[i] = fromTriangulationFace(faceTransformations[j], faceTriangulations[j]);
+      planarSurfaces[i].getImpl<detail::PlanarSurface_Impl>()->setCachedTriangulation(allHoles[j], result[i]);
+    }
+
+    return result;
+  }
+
   Point3d PlanarSurface::centroid() const {
     return getImpl<detail::PlanarSurface_Impl>()->centroid();
   }
@@ -225,6 +225,10 @@ namespace model {
     /// Get a triangulation of this surface, subsurfaces will be replaced by holes in the triangulation
     virtual std::vector<std::vector<Point3d>> triangulation() const;
 
+    /// Get the triangulation of each surface, same as calling triangulation() on each but surfaces without a current cached
+    /// triangulation are triangulated across numThreads worker threads (0 uses the hardware concurrency)
+    static std::vector<std::vector<std::vector<Point3d>>> triangulations(const std::vector<PlanarSurface>& planarSurfaces, unsigned numThreads = 0);
+
     /// Return the centroid of this planar surface's vertices
     Point3d centroid() const;
 
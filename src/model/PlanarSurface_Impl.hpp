@@ -156,6 +156,14 @@ namespace model {
 
       std::vector<std::vector<Point3d>> triangulation() const;
 
+      // vertices of child surfaces which are subtracted from this surface in the triangulation
+      std::vector<std::vector<Point3d>> triangulationHoles() const;
+
+      // cached triangulation, if it was computed for the current vertices and these holes
+      boost::optional<std::vector<std::vector<Point3d>>> cachedTriangulation(const std::vector<std::vector<Point3d>>& holes) const;
+
+      void setCachedTriangulation(const std::vector<std::vector<Point3d>>& holes, const std::vector<std::vector<Point3d>>& triangulation) const;
+
       Point3d centroid() const;
 
       std::vector<ModelObject> solarCollectors() const;
@@ -183,7 +191,8 @@ namespace model {
       mutable boost::optional<std::vector<Point3d>> m_cachedVertices;
       mutable boost::optional<Plane> m_cachedPlane;
       mutable boost::optional<Vector3d> m_cachedOutwardNormal;
-      mutable std::vector<std::vector<Point3d>> m_cachedTriangulation;
+      mutable boost::optional<std::vector<std::vector<Point3d>>> m_cachedTriangulation;
+      mutable std::vector<std::vector<Point3d>> m_cachedTriangulationHoles;
     };
 
   }  // namespace detail
@@ -48,25 +48,21 @@ namespace model {
 
     unsigned ResourceObject_Impl::directUseCount(bool excludeChildren) const {
 
+      if (!excludeChildren) {
+        return numSourceObjects();
+      }
+
       unsigned result = 0;
 
-      ModelObjectVector children;
-      if (excludeChildren) {
-        children = this->children();
-      }
+      ModelObjectVector children = this->children();
 
       WorkspaceObjectVector sources = this->sources();
       for (const WorkspaceObject& source : sources) {
-        if (excludeChildren) {
-          // check if this is a child
-          auto it =
-            std::find_if(children.begin(), children.end(), std::bind(handleEquals<ModelObject, Handle>, std::placeholders::_1, source.handle()));
-          if (it == children.end()) {
-            // non-Child--count the use
-            ++result;
-          }
-        } else {
-          // count the use
+        // check if this is a child
+        auto it =
+          std::find_if(children.begin(), children.end(), std::bind(handleEquals<ModelObject, Handle>, std::placeholders::_1, source.handle()));
+        if (it == children.end()) {
+          // non-Child--count the use
           ++result;
         }
       }
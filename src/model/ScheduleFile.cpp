@@ -44,6 +44,7 @@
 #include "../utilities/units/Unit.hpp"
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/FileContentCache.hpp"
 #include "../utilities/filetypes/CSVFile.hpp"
 
 #include <unordered_map>
@@ -215,11 +216,20 @@ namespace model {
       OS_ASSERT(result);
     }
 
+    /// Loads a CSVFile, only parsing it again when the file changed since the last call. Many ScheduleFile objects usually
+    /// share one file, so the cache is shared across the process. A clone is returned so callers cannot modify the cache.
+    static boost::optional<CSVFile> cachedCSVFile(const openstudio::path& p) {
+      static FileContentCache<CSVFile> cache;
+      boost::optional<CSVFile> result = cache.get(p, [](const openstudio::path& path) { return CSVFile::load(path); });
+      if (result) {
+        return result->clone();
+      }
+      return result;
+    }
+
     boost::optional<CSVFile> ScheduleFile_Impl::csvFile() const {
-      boost::optional<CSVFile> csvFile;
       ExternalFile externalFile = this->externalFile();
-      csvFile = CSVFile::load(externalFile.filePath());
-      return csvFile;
+      return cachedCSVFile(externalFile.filePath());
     }
 
     /* FIXME!
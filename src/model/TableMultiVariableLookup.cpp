@@ -41,9 +41,15 @@
 #include "../utilities/math/FloatCompare.hpp"
 
 #include "../utilities/core/Assert.hpp"
+#include "../utilities/core/Compare.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <set>
 
 namespace openstudio {
 namespace model {
@@ -108,6 +114,114 @@ namespace model {
 
   namespace detail {
 
+    static size_t axisIndex(const std::vector<double>& axis, double x) {
+      auto it = std::lower_bound(axis.begin(), axis.end(), x);
+      if ((it != axis.end()) && equal(*it, x)) {
+        return static_cast<size_t>(it - axis.begin());
+      }
+      OS_ASSERT(it != axis.begin());
+      --it;
+      OS_ASSERT(equal(*it, x));
+      return static_cast<size_t>(it - axis.begin());
+    }
+
+    static TableMultiVariableLookupGrid makeGrid(const std::vector<TableMultiVariableLookupPoint>& points, size_t numberOfVariables) {
+      TableMultiVariableLookupGrid grid;
+      grid.axes.resize(numberOfVariables);
+      for (const TableMultiVariableLookupPoint& pt : points) {
+        std::vector<double> x = pt.x();
+        for (size_t i = 0; i < numberOfVariables; ++i) {
+          grid.axes[i].push_back(x[i]);
+        }
+      }
+
+      size_t size = 1;
+      for (auto& axis : grid.axes) {
+        std::sort(axis.begin(), axis.end());
+        axis.erase(std::unique(axis.begin(), axis.end(), [](double a, double b) { return equal(a, b); }), axis.end());
+        size *= axis.size();
+      }
+
+      grid.values.assign(size, std::numeric_limits<double>::quiet_NaN());
+      for (const TableMultiVariableLookupPoint& pt : points) {
+        std::vector<double> x = pt.x();
+        size_t index = 0;
+        for (size_t i = 0; i < numberOfVariables; ++i) {
+          index = index * grid.axes[i].size() + axisIndex(grid.axes[i], x[i]);
+        }
+        grid.values[index] = pt.y();
+      }
+
+      grid.complete = (size > 0) && std::none_of(grid.values.begin(), grid.values.end(), [](double y) { return std::isnan(y); });
+      return grid;
+    }
+
+    // Lagrange interpolation weights along one axis using a window of up to numberOfPoints grid values around x.
+    // Outside of the axis range the two end values are used, which extrapolates linearly.
+    static void axisWeights(const std::vector<double>& axis, double x, size_t numberOfPoints, size_t& start, std::vector<double>& weights) {
+      size_t n = axis.size();
+      if (n == 1) {
+        start = 0;
+        weights.assign(1, 1.0);
+        return;
+      }
+
+      size_t k = std::min(numberOfPoints, n);
+      if ((x < axis.front()) || (x > axis.back())) {
+        k = 2;
+      }
+
+      // index of the interval containing x, then center the window on it
+      size_t i = static_cast<size_t>(std::upper_bound(axis.begin(), axis.end(), x) - axis.begin());
+      i = (i == 0) ? 0 : i - 1;
+      size_t offset = (k - 1) / 2;
+      start = (i > offset) ? i - offset : 0;
+      start = std::min(start, n - k);
+
+      weights.assign(k, 1.0);
+      for (size_t j = 0; j < k; ++j) {
+        for (size_t m = 0; m < k; ++m) {
+          if (m != j) {
+            weights[j] *= (x - axis[start + m]) / (axis[start + j] - axis[start + m]);
+          }
+        }
+      }
+    }
+
+    static double interpolate(const TableMultiVariableLookupGrid& grid, const std::vector<double>& x, size_t numberOfPoints) {
+      size_t numberOfVariables = grid.axes.size();
+      std::vector<size_t> starts(numberOfVariables);
+      std::vector<std::vector<double>> weights(numberOfVariables);
+      for (size_t i = 0; i < numberOfVariables; ++i) {
+        axisWeights(grid.axes[i], x[i], numberOfPoints, starts[i], weights[i]);
+      }
+
+      // sum over the tensor product of the per axis windows
+      double result = 0.0;
+      std::vector<size_t> counters(numberOfVariables, 0);
+      while (true) {
+        double weight = 1.0;
+        size_t index = 0;
+        for (size_t i = 0; i < numberOfVariables; ++i) {
+          weight *= weights[i][counters[i]];
+          index = index * grid.axes[i].size() + starts[i] + counters[i];
+        }
+        result += weight * grid.values[index];
+
+        size_t i = numberOfVariables;
+        while (i > 0) {
+          --i;
+          if (++counters[i] < weights[i].size()) {
+            break;
+          }
+          counters[i] = 0;
+          if (i == 0) {
+            return result;
+          }
+        }
+      }
+    }
+
     bool TableMultiVariableLookup_Impl::xValuesEqual(const std::vector<double>& a, const std::vector<double>& b) {
       bool result = true;
 
@@ -127,16 +241,25 @@ namespace model {
     TableMultiVariableLookup_Impl::TableMultiVariableLookup_Impl(const IdfObject& idfObject, Model_Impl* model, bool keepHandle)
       : Curve_Impl(idfObject, model, keepHandle) {
       OS_ASSERT(idfObject.iddObject().type() == TableMultiVariableLookup::iddObjectType());
+
+      // connect signals
+      this->TableMultiVariableLookup_Impl::onChange.connect<TableMultiVariableLookup_Impl, &TableMultiVariableLookup_Impl::clearCachedGrid>(this);
     }
 
     TableMultiVariableLookup_Impl::TableMultiVariableLookup_Impl(const openstudio::detail::WorkspaceObject_Impl& other, Model_Impl* model,
                                                                  bool keepHandle)
       : Curve_Impl(other, model, keepHandle) {
       OS_ASSERT(other.iddObject().type() == TableMultiVariableLookup::iddObjectType());
+
+      // connect signals
+      this->TableMultiVariableLookup_Impl::onChange.connect<TableMultiVariableLookup_Impl, &TableMultiVariableLookup_Impl::clearCachedGrid>(this);
     }
 
     TableMultiVariableLookup_Impl::TableMultiVariableLookup_Impl(const TableMultiVariableLookup_Impl& other, Model_Impl* model, bool keepHandle)
-      : Curve_Impl(other, model, keepHandle) {}
+      : Curve_Impl(other, model, keepHandle) {
+      // connect signals
+      this->TableMultiVariableLookup_Impl::onChange.connect<TableMultiVariableLookup_Impl, &TableMultiVariableLookup_Impl::clearCachedGrid>(this);
+    }
 
     const std::vector<std::string>& TableMultiVariableLookup_Impl::outputVariableNames() const {
       static const std::vector<std::string> result;
@@ -701,8 +824,64 @@ namespace model {
     }
 
     double TableMultiVariableLookup_Impl::evaluate(const std::vector<double>& x) const {
-      LOG(Warn, "Curve evaluation isn't implemented for TableMultiVariableLookup");
-      return -9999.0;
+      CurveEvaluationStatistics statistics;
+      std::vector<double> result = evaluate(std::vector<std::vector<double>>(1u, x), statistics);
+      OS_ASSERT(result.size() == 1u);
+      return result[0];
+    }
+
+    std::vector<double> TableMultiVariableLookup_Impl::evaluate(const std::vector<std::vector<double>>& x,
+                                                                CurveEvaluationStatistics& statistics) const {
+      // the grid is only rebuilt after the table changes
+      size_t numberOfVariables = numberofIndependentVariables();
+      const TableMultiVariableLookupGrid& grid = this->grid();
+      if (!grid.complete) {
+        LOG(Warn, "Cannot evaluate " << briefDescription() << ", the points do not define a complete rectangular grid.");
+        return std::vector<double>(x.size(), -9999.0);
+      }
+
+      std::string method = interpolationMethod();
+      size_t numberOfPoints = 2;
+      if (istringEqual(method, "LagrangeInterpolationLinearExtrapolation")) {
+        numberOfPoints = numberofInterpolationPoints();
+      } else if (istringEqual(method, "EvaluateCurveToLimits")) {
+        LOG(Warn, "Interpolation method EvaluateCurveToLimits is not supported for " << briefDescription() << ", using linear interpolation.");
+      }
+
+      std::vector<boost::optional<double>> minimums{minimumValueofX1(), minimumValueofX2(), minimumValueofX3(), minimumValueofX4(),
+                                                    minimumValueofX5()};
+      std::vector<boost::optional<double>> maximums{maximumValueofX1(), maximumValueofX2(), maximumValueofX3(), maximumValueofX4(),
+                                                    maximumValueofX5()};
+      boost::optional<double> minOutput = minimumTableOutput();
+      boost::optional<double> maxOutput = maximumTableOutput();
+      boost::optional<double> normalization = normalizationReference();
+      if (normalization && (normalization.get() == 0.0)) {
+        normalization.reset();
+      }
+
+      unsigned numInputsClamped = 0;
+      unsigned numOutputsClamped = 0;
+      std::vector<double> results;
+      results.reserve(x.size());
+      std::vector<double> values(numberOfVariables);
+      for (const auto& point : x) {
+        OS_ASSERT(point.size() == numberOfVariables);
+        for (size_t i = 0; i < numberOfVariables; ++i) {
+          values[i] = clampValue(point[i], minimums[i], maximums[i], numInputsClamped);
+        }
+
+        double result = interpolate(grid, values, numberOfPoints);
+        if (normalization) {
+          result /= normalization.get();
+        }
+        results.push_back(clampValue(result, minOutput, maxOutput, numOutputsClamped));
+      }
+
+      statistics.numInputsReset += numInputsClamped;
+      statistics.numOutputsReset += numOutputsClamped;
+      warnClampedValues(numInputsClamped, numOutputsClamped, x.size());
+
+      return results;
     }
 
     bool TableMultiVariableLookup_Impl::addPoint(const std::vector<double>& t_xValues, double t_yValue) {
@@ -723,6 +902,98 @@ namespace model {
       return true;
     }
 
+    bool TableMultiVariableLookup_Impl::addPoints(const std::vector<TableMultiVariableLookupPoint>& points) {
+      unsigned n_independent = numberofIndependentVariables();
+
+      // Each distinct value of an independent variable gets an id, and each existing point is keyed by the ids of its x values.
+      // A new point is a duplicate if some combination of the ids of the values equal to its x values (usually one per
+      // variable) is an existing key, which matches xValuesEqual against every point without rescanning the extensible groups.
+      std::vector<std::map<double, size_t>> valueIds(n_independent);
+      std::set<std::vector<size_t>> keys;
+
+      auto addKey = [&valueIds, &keys](const std::vector<double>& x) {
+        std::vector<size_t> key(x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+          key[i] = valueIds[i].emplace(x[i], valueIds[i].size()).first->second;
+        }
+        keys.insert(key);
+      };
+
+      auto isDuplicate = [&valueIds, &keys](const std::vector<double>& x) {
+        std::vector<std::vector<size_t>> candidates(x.size());
+        for (size_t i = 0; i < x.size(); ++i) {
+          const std::map<double, size_t>& ids = valueIds[i];
+          auto it = ids.lower_bound(x[i]);
+          for (auto up = it; (up != ids.end()) && equal(up->first, x[i]); ++up) {
+            candidates[i].push_back(up->second);
+          }
+          for (auto down = it; (down != ids.begin()) && equal(std::prev(down)->first, x[i]); --down) {
+            candidates[i].push_back(std::prev(down)->second);
+          }
+          if (candidates[i].empty()) {
+            return false;
+          }
+        }
+
+        std::vector<size_t> positions(x.size(), 0);
+        std::vector<size_t> key(x.size());
+        while (true) {
+          for (size_t i = 0; i < x.size(); ++i) {
+            key[i] = candidates[i][positions[i]];
+          }
+          if (keys.count(key) > 0) {
+            return true;
+          }
+
+          // next combination
+          size_t i = 0;
+          while ((i < x.size()) && (++positions[i] == candidates[i].size())) {
+            positions[i] = 0;
+            ++i;
+          }
+          if (i == x.size()) {
+            return false;
+          }
+        }
+      };
+
+      for (const TableMultiVariableLookupPoint& pt : this->points()) {
+        addKey(pt.x());
+      }
+
+      bool result = true;
+      model::TableMultiVariableLookup table = getObject<model::TableMultiVariableLookup>();
+      for (const TableMultiVariableLookupPoint& pt : points) {
+        std::vector<double> x = pt.x();
+        if ((x.size() != n_independent) || isDuplicate(x)) {
+          result = false;
+          continue;
+        }
+
+        for (double value : x) {
+          IdfExtensibleGroup eg = table.pushExtensibleGroup();
+          eg.setDouble(0, value);
+        }
+        IdfExtensibleGroup eg = table.pushExtensibleGroup();
+        eg.setDouble(0, pt.y());
+
+        addKey(x);
+      }
+
+      return result;
+    }
+
+    const TableMultiVariableLookupGrid& TableMultiVariableLookup_Impl::grid() const {
+      if (!m_cachedGrid) {
+        m_cachedGrid = makeGrid(points(), numberofIndependentVariables());
+      }
+      return m_cachedGrid.get();
+    }
+
+    void TableMultiVariableLookup_Impl::clearCachedGrid() {
+      m_cachedGrid.reset();
+    }
+
     std::vector<TableMultiVariableLookupPoint> TableMultiVariableLookup_Impl::points() const {
       std::vector<TableMultiVariableLookupPoint> result;
 
@@ -848,12 +1119,7 @@ namespace model {
       this->clearExtensibleGroups();
 
       // And we add all points
-      bool result = true;
-      for (const TableMultiVariableLookupPoint& pt : points) {
-        result &= addPoint(pt);
-      }
-
-      return result;
+      return addPoints(points);
     }
 
     bool TableMultiVariableLookup_Impl::addPoint(const TableMultiVariableLookupPoint& point) {
@@ -1286,6 +1552,19 @@ namespace model {
     return getImpl<detail::TableMultiVariableLookup_Impl>()->evaluate(x);
   }
 
+  std::vector<double> TableMultiVariableLookup::evaluate(const std::vector<std::vector<double>>& x) const {
+    CurveEvaluationStatistics statistics;
+    return getImpl<detail::TableMultiVariableLookup_Impl>()->evaluate(x, statistics);
+  }
+
+  std::vector<double> TableMultiVariableLookup::evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const {
+    return getImpl<detail::TableMultiVariableLookup_Impl>()->evaluate(x, statistics);
+  }
+
+  bool TableMultiVariableLookup::addPoints(const std::vector<TableMultiVariableLookupPoint>& points) {
+    return getImpl<detail::TableMultiVariableLookup_Impl>()->addPoints(points);
+  }
+
   bool TableMultiVariableLookup::addPoint(const TableMultiVariableLookupPoint& point) {
     return getImpl<detail::TableMultiVariableLookup_Impl>()->addPoint(point);
   }
@@ -301,6 +301,10 @@ namespace model {
     // Return a vector of points, this is the entire set of data points
     std::vector<TableMultiVariableLookupPoint> points() const;
 
+    /** Adds several points at once, which is much faster than repeated calls to addPoint for large tables.
+   *  Points with the wrong number of independent variables or duplicate x values are skipped, and false is returned. */
+    bool addPoints(const std::vector<TableMultiVariableLookupPoint>& points);
+
     // Directly set the points from a vector, will delete any existing points
     bool setPoints(const std::vector<TableMultiVariableLookupPoint>& points);
 
@@ -319,10 +323,20 @@ namespace model {
     int numVariables() const;
 
     /**
-  * Not supported.  This is inherited from the base class.
+  * Interpolates the table at x. The points must form a complete rectangular grid. LinearInterpolationOfTable uses
+  * multilinear interpolation, LagrangeInterpolationLinearExtrapolation uses numberofInterpolationPoints per
+  * independent variable, and EvaluateCurveToLimits is not supported and falls back to linear interpolation.
+  * Values beyond the table extrapolate linearly. Inputs are limited to the minimum and maximum values of each
+  * variable and the output to the minimum and maximum table output, if set. Returns -9999 if the table cannot be evaluated.
   */
     double evaluate(const std::vector<double>& x) const;
 
+    /** Evaluates the table at each point of x, building the interpolation grid only once. */
+    std::vector<double> evaluate(const std::vector<std::vector<double>>& x) const;
+
+    /** Same as the batch evaluate above, and adds the number of values that were reset to statistics. */
+    std::vector<double> evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const;
+
     //@}
    protected:
     /// @cond
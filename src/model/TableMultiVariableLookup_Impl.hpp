@@ -42,6 +42,15 @@ namespace model {
 
   namespace detail {
 
+    /** Rectangular grid built from the points of a table: the sorted unique values of each independent variable (axes)
+     *  and the y values in row-major order, NaN where the table has no point for a grid node. */
+    struct TableMultiVariableLookupGrid
+    {
+      std::vector<std::vector<double>> axes;
+      std::vector<double> values;
+      bool complete = true;
+    };
+
     /** TableMultiVariableLookup_Impl is a Curve_Impl that is the implementation class for TableMultiVariableLookup.*/
     class MODEL_API TableMultiVariableLookup_Impl : public Curve_Impl
     {
@@ -278,6 +287,8 @@ namespace model {
 
       double evaluate(const std::vector<double>& x) const override;
 
+      std::vector<double> evaluate(const std::vector<std::vector<double>>& x, CurveEvaluationStatistics& statistics) const override;
+
       // Primary way to add a point
       bool addPoint(const TableMultiVariableLookupPoint& point);
 
@@ -289,6 +300,9 @@ namespace model {
       bool addPoint(double x1, double x2, double x3, double x4, double yValue);
       bool addPoint(double x1, double x2, double x3, double x4, double x5, double yValue);
 
+      // Add several points at once, duplicates are checked against an index of the x values instead of every existing point
+      bool addPoints(const std::vector<TableMultiVariableLookupPoint>& points);
+
       // Directly set the points from a vector, will delete any existing points
       bool setPoints(const std::vector<TableMultiVariableLookupPoint>& points);
 
@@ -299,7 +313,14 @@ namespace model {
       //@}
      protected:
      private:
+      // Grid of the points, built on first use and cleared whenever the table changes
+      const TableMultiVariableLookupGrid& grid() const;
+
+      void clearCachedGrid();
+
       REGISTER_LOGGER("openstudio.model.TableMultiVariableLookup");
+
+      mutable boost::optional<TableMultiVariableLookupGrid> m_cachedGrid;
     };
 
   }  // namespace detail
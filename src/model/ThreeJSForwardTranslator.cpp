@@ -320,35 +320,29 @@ namespace model {
 
     // get the vertices
     Point3dVector vertices = planarSurface.vertices();
-    Transformation t = Transformation::alignFace(vertices);
-    //Transformation r = t.rotationMatrix();
-    Transformation tInv = t.inverse();
-    Point3dVector faceVertices = reverse(tInv * vertices);
-
-    // get vertices of all sub surfaces
-    Point3dVectorVector faceSubVertices;
-    if (surface) {
-      for (const auto& subSurface : surface->subSurfaces()) {
-        faceSubVertices.push_back(reverse(tInv * subSurface.vertices()));
-      }
-    }
 
+    // faces in building coordinates, vertices in the order they are written
     Point3dVectorVector finalFaceVertices;
     if (triangulateSurfaces) {
-      finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+      // the triangulation is cached on the surface, sub surfaces are holes
+      for (const auto& triangle : planarSurface.triangulation()) {
+        finalFaceVertices.push_back(buildingTransformation * triangle);
+      }
       if (finalFaceVertices.empty()) {
-        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << faceSubVertices.size() << " sub surfaces");
+        size_t numSubSurfaces = surface ? surface->subSurfaces().size() : 0;
+        LOG_FREE(Error, "modelToThreeJS", "Failed to triangulate surface " << name << " with " << numSubSurfaces << " sub surfaces");
         return;
       }
     } else {
-      finalFaceVertices.push_back(faceVertices);
+      Transformation t = Transformation::alignFace(vertices);
+      Transformation tInv = t.inverse();
+      Point3dVector faceVertices = reverse(tInv * vertices);
+      finalFaceVertices.push_back(reverse(buildingTransformation * t * faceVertices));
     }
 
     Point3dVector allVertices;
     std::vector<size_t> faceIndices;
-    for (const auto& finalFaceVerts : finalFaceVertices) {
-      Point3dVector finalVerts = buildingTransformation * t * finalFaceVerts;
-      //normal = buildingTransformation.rotationMatrix*r*z
+    for (const auto& finalVerts : finalFaceVertices) {
 
       // https://github.com/mrdoob/three.js/wiki/JSON-Model-format-3
       // 0 indicates triangle
@@ -365,14 +359,9 @@ namespace model {
         faceIndices.push_back(openstudioFaceFormatId());
       }
 
-      Point3dVector::reverse_iterator it = finalVerts.rbegin();
-      Point3dVector::reverse_iterator itend = finalVerts.rend();
-      for (; it != itend; ++it) {
-        faceIndices.push_back(getVertexIndex(*it, allVertices));
+      for (const auto& vertex : finalVerts) {
+        faceIndices.push_back(getVertexIndex(vertex, allVertices));
       }
-
-      // convert to 1 based indices
-      //face_indices.each_index {|i| face_indices[i] = face_indices[i] + 1}
     }
 
     ThreeGeometryData geometryData(toThreeVector(allVertices), faceIndices);
@@ -442,6 +431,29 @@ namespace model {
   }
 
   ThreeScene ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage) {
+    std::vector<ThreeGeometry> allGeometries;
+    ThreeScene scene = translateModel(model, triangulateSurfaces, updatePercentage,
+                                      [&allGeometries](const ThreeGeometry& geometry) { allGeometries.push_back(geometry); });
+    return ThreeScene(scene.metadata(), allGeometries, scene.materials(), scene.object());
+  }
+
+  void ThreeJSForwardTranslator::modelToThreeJS(const Model& model, bool triangulateSurfaces, std::ostream& os) {
+    ThreeSceneStreamWriter writer(os);
+    ThreeScene scene = translateModel(model, triangulateSurfaces, [](double percentage) {},
+                                      [&writer](const ThreeGeometry& geometry) { writer.addGeometry(geometry); });
+    writer.finish(scene.materials(), scene.metadata(), scene.object());
+  }
+
+  void ThreeJSForwardTranslator::modelToThreeJSBinary(const Model& model, std::ostream& os, std::ostream& buffer) {
+    ThreeSceneStreamWriter writer(os, buffer);
+    ThreeScene scene =
+      translateModel(model, true, [](double percentage) {}, [&writer](const ThreeGeometry& geometry) { writer.addGeometry(geometry); });
+    writer.finish(scene.materials(), scene.metadata(), scene.object());
+  }
+
+  ThreeScene ThreeJSForwardTranslator::translateModel(const Model& model, bool triangulateSurfaces,
+                                                      const std::function<void(double)>& updatePercentage,
+                                                      const std::function<void(const ThreeGeometry&)>& addGeometry) {
     m_logSink.setThreadId(std::this_thread::get_id());
     m_logSink.resetStringStream();
 
@@ -462,7 +474,6 @@ namespace model {
     buildMaterials(model, materials, materialMap);
 
     std::vector<ThreeSceneChild> sceneChildren;
-    std::vector<ThreeGeometry> allGeometries;
     std::vector<ThreeModelObjectMetadata> modelObjectMetadata;
 
     // get number of things to translate
@@ -477,6 +488,11 @@ namespace model {
     std::vector<PlanarSurface>::size_type N = planarSurfaces.size() + planarSurfaceGroups.size() + buildingStories.size() + buildingUnits.size()
                                               + thermalZones.size() + spaceTypes.size() + defaultConstructionSets.size() + 1;
 
+    // triangulate all surfaces in parallel up front, makeGeometries then reads the cached triangulations
+    if (triangulateSurfaces) {
+      PlanarSurface::triangulations(planarSurfaces);
+    }
+
     // loop over all surfaces
     for (const auto& planarSurface : planarSurfaces) {
       std::vector<ThreeGeometry> geometries;
@@ -487,7 +503,7 @@ namespace model {
       size_t n = geometries.size();
       for (size_t i = 0; i < n; ++i) {
 
-        allGeometries.push_back(geometries[i]);
+        addGeometry(geometries[i]);
 
         std::string thisUUID(toThreeUUID(toString(createUUID())));
         std::string thisName(userDatas[i].name());
@@ -620,7 +636,7 @@ namespace model {
 
     ThreeSceneMetadata metadata(buildingStoryNames, threeBoundingBox, northAxis, modelObjectMetadata);
 
-    ThreeScene scene(metadata, allGeometries, materials, sceneObject);
+    ThreeScene scene(metadata, std::vector<ThreeGeometry>(), materials, sceneObject);
 
     updatePercentage(100.0);
 
@@ -58,6 +58,14 @@ namespace model {
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces);
     ThreeScene modelToThreeJS(const Model& model, bool triangulateSurfaces, std::function<void(double)> updatePercentage);
 
+    /// Write an OpenStudio Model to ThreeJS JSON, geometries are streamed to os as surfaces are translated rather than held in a ThreeScene
+    /// Output is the same as modelToThreeJS(model, triangulateSurfaces).toJSON(false)
+    void modelToThreeJS(const Model& model, bool triangulateSurfaces, std::ostream& os);
+
+    /// Write an OpenStudio Model to ThreeJS JSON for display, triangulated vertex positions and normals are written to buffer as Float32 arrays
+    /// See ThreeSceneStreamWriter for the format
+    void modelToThreeJSBinary(const Model& model, std::ostream& os, std::ostream& buffer);
+
     /// Get warning messages generated by the last translation.
     std::vector<LogMessage> warnings() const;
 
@@ -67,6 +75,10 @@ namespace model {
    private:
     REGISTER_LOGGER("openstudio.model.ThreeJSForwardTranslator");
 
+    // geometries are passed to addGeometry as they are made, the scene is returned without them
+    ThreeScene translateModel(const Model& model, bool triangulateSurfaces, const std::function<void(double)>& updatePercentage,
+                              const std::function<void(const ThreeGeometry&)>& addGeometry);
+
     StringStreamLogSink m_logSink;
   };
 
@@ -0,0 +1,180 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "ModelFixture.hpp"
+#include "../Curve.hpp"
+#include "../CurveBicubic.hpp"
+#include "../CurveBiquadratic.hpp"
+#include "../CurveCubic.hpp"
+#include "../CurveLinear.hpp"
+#include "../CurveQuadratic.hpp"
+#include "../CurveQuadraticLinear.hpp"
+#include "../CurveQuartic.hpp"
+
+using namespace openstudio;
+using namespace openstudio::model;
+
+TEST_F(ModelFixture, Curve_evaluateBatch) {
+
+  Model m;
+
+  CurveLinear linear(m);
+  EXPECT_TRUE(linear.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(linear.setCoefficient2x(2.0));
+  EXPECT_TRUE(linear.setMinimumValueofx(0.5));
+  EXPECT_TRUE(linear.setMaximumValueofx(3.0));
+  EXPECT_TRUE(linear.setMinimumCurveOutput(2.5));
+  EXPECT_TRUE(linear.setMaximumCurveOutput(6.0));
+
+  CurveQuadratic quadratic(m);
+  EXPECT_TRUE(quadratic.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(quadratic.setCoefficient2x(2.0));
+  EXPECT_TRUE(quadratic.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(quadratic.setMinimumValueofx(0.5));
+  EXPECT_TRUE(quadratic.setMaximumValueofx(3.0));
+  EXPECT_TRUE(quadratic.setMinimumCurveOutput(3.0));
+  EXPECT_TRUE(quadratic.setMaximumCurveOutput(30.0));
+
+  CurveCubic cubic(m);
+  EXPECT_TRUE(cubic.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(cubic.setCoefficient2x(2.0));
+  EXPECT_TRUE(cubic.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(cubic.setCoefficient4xPOW3(4.0));
+  EXPECT_TRUE(cubic.setMinimumValueofx(0.5));
+  EXPECT_TRUE(cubic.setMaximumValueofx(3.0));
+  EXPECT_TRUE(cubic.setMinimumCurveOutput(4.0));
+  EXPECT_TRUE(cubic.setMaximumCurveOutput(100.0));
+
+  CurveQuartic quartic(m);
+  EXPECT_TRUE(quartic.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(quartic.setCoefficient2x(2.0));
+  EXPECT_TRUE(quartic.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(quartic.setCoefficient4xPOW3(4.0));
+  EXPECT_TRUE(quartic.setCoefficient5xPOW4(5.0));
+  EXPECT_TRUE(quartic.setMinimumValueofx(0.5));
+  EXPECT_TRUE(quartic.setMaximumValueofx(3.0));
+  EXPECT_TRUE(quartic.setMinimumCurveOutput(4.0));
+  EXPECT_TRUE(quartic.setMaximumCurveOutput(500.0));
+
+  CurveBiquadratic biquadratic(m);
+  EXPECT_TRUE(biquadratic.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(biquadratic.setCoefficient2x(2.0));
+  EXPECT_TRUE(biquadratic.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(biquadratic.setCoefficient4y(4.0));
+  EXPECT_TRUE(biquadratic.setCoefficient5yPOW2(5.0));
+  EXPECT_TRUE(biquadratic.setCoefficient6xTIMESY(6.0));
+  EXPECT_TRUE(biquadratic.setMinimumValueofx(0.1));
+  EXPECT_TRUE(biquadratic.setMaximumValueofx(3.0));
+  EXPECT_TRUE(biquadratic.setMinimumValueofy(10.0));
+  EXPECT_TRUE(biquadratic.setMaximumValueofy(30.0));
+  EXPECT_TRUE(biquadratic.setMinimumCurveOutput(700.0));
+  EXPECT_TRUE(biquadratic.setMaximumCurveOutput(4000.0));
+
+  CurveQuadraticLinear quadraticLinear(m);
+  EXPECT_TRUE(quadraticLinear.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(quadraticLinear.setCoefficient2x(2.0));
+  EXPECT_TRUE(quadraticLinear.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(quadraticLinear.setCoefficient4y(4.0));
+  EXPECT_TRUE(quadraticLinear.setCoefficient5xTIMESY(5.0));
+  EXPECT_TRUE(quadraticLinear.setCoefficient6xPOW2TIMESY(6.0));
+  EXPECT_TRUE(quadraticLinear.setMinimumValueofx(0.1));
+  EXPECT_TRUE(quadraticLinear.setMaximumValueofx(3.0));
+  EXPECT_TRUE(quadraticLinear.setMinimumValueofy(10.0));
+  EXPECT_TRUE(quadraticLinear.setMaximumValueofy(30.0));
+  EXPECT_TRUE(quadraticLinear.setMinimumCurveOutput(50.0));
+  EXPECT_TRUE(quadraticLinear.setMaximumCurveOutput(2000.0));
+
+  CurveBicubic bicubic(m);
+  EXPECT_TRUE(bicubic.setCoefficient1Constant(1.0));
+  EXPECT_TRUE(bicubic.setCoefficient2x(2.0));
+  EXPECT_TRUE(bicubic.setCoefficient3xPOW2(3.0));
+  EXPECT_TRUE(bicubic.setCoefficient4y(4.0));
+  EXPECT_TRUE(bicubic.setCoefficient5yPOW2(5.0));
+  EXPECT_TRUE(bicubic.setCoefficient6xTIMESY(6.0));
+  EXPECT_TRUE(bicubic.setCoefficient7xPOW3(7.0));
+  EXPECT_TRUE(bicubic.setCoefficient8yPOW3(8.0));
+  EXPECT_TRUE(bicubic.setCoefficient9xPOW2TIMESY(9.0));
+  EXPECT_TRUE(bicubic.setCoefficient10xTIMESYPOW2(10.0));
+  EXPECT_TRUE(bicubic.setMinimumValueofx(0.1));
+  EXPECT_TRUE(bicubic.setMaximumValueofx(3.0));
+  EXPECT_TRUE(bicubic.setMinimumValueofy(1.0));
+  EXPECT_TRUE(bicubic.setMaximumValueofy(3.0));
+  EXPECT_TRUE(bicubic.setMinimumCurveOutput(25.0));
+  EXPECT_TRUE(bicubic.setMaximumCurveOutput(1000.0));
+
+  // points below, within and above the limits of every variable
+  std::vector<std::vector<double>> xPoints;
+  std::vector<std::vector<double>> xyPoints;
+  std::vector<std::vector<double>> xySmallPoints;
+  for (double x = 0.0; x <= 4.0; x += 0.25) {
+    xPoints.push_back({x});
+    for (double y = 5.0; y <= 40.0; y += 2.5) {
+      xyPoints.push_back({x, y});
+    }
+    for (double y = 0.0; y <= 4.0; y += 0.25) {
+      xySmallPoints.push_back({x, y});
+    }
+  }
+
+  struct BatchCase
+  {
+    Curve curve;
+    std::vector<std::vector<double>> points;
+    unsigned numInputsReset;
+    unsigned numOutputsReset;
+  };
+
+  std::vector<BatchCase> cases{
+    {linear, xPoints, 6u, 9u},
+    {quadratic, xPoints, 6u, 8u},
+    {cubic, xPoints, 6u, 9u},
+    {quartic, xPoints, 6u, 8u},
+    {biquadratic, xyPoints, 177u, 129u},
+    {quadraticLinear, xyPoints, 177u, 33u},
+    {bicubic, xySmallPoints, 221u, 35u},
+  };
+
+  for (const auto& batchCase : cases) {
+    SCOPED_TRACE(batchCase.curve.briefDescription());
+
+    CurveEvaluationStatistics statistics;
+    std::vector<double> results = batchCase.curve.evaluate(batchCase.points, statistics);
+    ASSERT_EQ(batchCase.points.size(), results.size());
+    for (size_t i = 0; i < batchCase.points.size(); ++i) {
+      EXPECT_DOUBLE_EQ(batchCase.curve.evaluate(batchCase.points[i]), results[i]);
+    }
+    EXPECT_EQ(batchCase.numInputsReset, statistics.numInputsReset);
+    EXPECT_EQ(batchCase.numOutputsReset, statistics.numOutputsReset);
+
+    EXPECT_EQ(results, batchCase.curve.evaluate(batchCase.points));
+    EXPECT_TRUE(batchCase.curve.evaluate(std::vector<std::vector<double>>()).empty());
+  }
+}
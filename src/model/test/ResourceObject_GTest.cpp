@@ -40,6 +40,15 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../DefaultConstructionSet.hpp"
+#include "../DefaultSurfaceConstructions.hpp"
+#include "../Space.hpp"
+#include "../ScheduleRuleset.hpp"
+#include "../ScheduleRuleset_Impl.hpp"
+#include "../ScheduleRule.hpp"
+#include "../ScheduleRule_Impl.hpp"
+#include "../ScheduleDay.hpp"
+#include "../ScheduleDay_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 
@@ -134,3 +143,65 @@ TEST_F(ModelFixture, ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data", newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1", anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture, ResourceObject_PurgeUnusedResourceObjects) {
+  Model model;
+  Space space(model);
+  model.purgeUnusedResourceObjects();
+
+  // space -> construction set -> surface constructions -> construction -> material is in use
+  StandardOpaqueMaterial usedMaterial(model);
+  Construction usedConstruction(model);
+  EXPECT_TRUE(usedConstruction.setLayers(MaterialVector(1u, usedMaterial)));
+  DefaultSurfaceConstructions usedSurfaceConstructions(model);
+  EXPECT_TRUE(usedSurfaceConstructions.setWallConstruction(usedConstruction));
+  DefaultConstructionSet usedConstructionSet(model);
+  EXPECT_TRUE(usedConstructionSet.setDefaultExteriorSurfaceConstructions(usedSurfaceConstructions));
+  EXPECT_TRUE(space.setDefaultConstructionSet(usedConstructionSet));
+
+  // the same chain without a space at the end is not
+  StandardOpaqueMaterial unusedMaterial(model);
+  Construction unusedConstruction(model);
+  EXPECT_TRUE(unusedConstruction.setLayers(MaterialVector(1u, unusedMaterial)));
+  DefaultSurfaceConstructions unusedSurfaceConstructions(model);
+  EXPECT_TRUE(unusedSurfaceConstructions.setWallConstruction(unusedConstruction));
+
+  // an unused construction does not keep a used material from being used
+  Construction otherConstruction(model);
+  EXPECT_TRUE(otherConstruction.setLayers(MaterialVector(1u, usedMaterial)));
+
+  IdfObjectVector removedObjects = model.purgeUnusedResourceObjects();
+  EXPECT_EQ(4u, removedObjects.size());
+  EXPECT_FALSE(unusedMaterial.initialized());
+  EXPECT_FALSE(unusedConstruction.initialized());
+  EXPECT_FALSE(unusedSurfaceConstructions.initialized());
+  EXPECT_FALSE(otherConstruction.initialized());
+
+  EXPECT_TRUE(usedMaterial.initialized());
+  EXPECT_TRUE(usedConstruction.initialized());
+  EXPECT_TRUE(usedSurfaceConstructions.initialized());
+  EXPECT_TRUE(usedConstructionSet.initialized());
+  for (const ResourceObject& resource : model.getModelObjects<ResourceObject>()) {
+    EXPECT_GT(resource.nonResourceObjectUseCount(true), 0u);
+  }
+
+  EXPECT_TRUE(model.purgeUnusedResourceObjects().empty());
+}
+
+TEST_F(ModelFixture, ResourceObject_PurgeUnusedResourceObjects_ScheduleRuleset) {
+  Model model;
+
+  // the rule points to its day schedule, but is removed along with the unused ruleset
+  ScheduleRuleset scheduleRuleset(model);
+  ScheduleRule scheduleRule(scheduleRuleset);
+  ScheduleDay ruleDaySchedule = scheduleRule.daySchedule();
+
+  IdfObjectVector removedObjects = model.purgeUnusedResourceObjects();
+  EXPECT_FALSE(removedObjects.empty());
+  EXPECT_FALSE(scheduleRuleset.initialized());
+  EXPECT_FALSE(scheduleRule.initialized());
+  EXPECT_FALSE(ruleDaySchedule.initialized());
+  EXPECT_TRUE(model.getConcreteModelObjects<ScheduleDay>().empty());
+
+  EXPECT_TRUE(model.purgeUnusedResourceObjects().empty());
+}
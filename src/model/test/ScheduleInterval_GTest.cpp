@@ -43,6 +43,7 @@
 
 #include "../../utilities/core/PathHelpers.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
+#include "../../utilities/filetypes/CSVFile.hpp"
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -311,6 +312,19 @@ TEST_F(ModelFixture, ScheduleFile) {
   schedule3.setRowstoSkipatTop(1);
   EXPECT_EQ(1, schedule3.rowstoSkipatTop());
 
+  // schedules sharing a file share one parsed copy, but callers get their own
+  boost::optional<CSVFile> csvFile = schedule.csvFile();
+  ASSERT_TRUE(csvFile);
+  boost::optional<CSVFile> csvFile2 = schedule2.csvFile();
+  ASSERT_TRUE(csvFile2);
+  EXPECT_EQ(csvFile->string(), csvFile2->string());
+  unsigned numColumns = csvFile->numColumns();
+  csvFile->addColumn(std::vector<double>(csvFile->numRows(), 1.0));
+  EXPECT_EQ(numColumns + 1, csvFile->numColumns());
+  csvFile2 = schedule3.csvFile();
+  ASSERT_TRUE(csvFile2);
+  EXPECT_EQ(numColumns, csvFile2->numColumns());
+
   //EXPECT_TRUE(externalfile.setColumnSeparator("Tab"));
   //EXPECT_EQ("Tab", externalfile.columnSeparator().get());
   //EXPECT_EQ("Comma", externalfile.columnSeparator().get());
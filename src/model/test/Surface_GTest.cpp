@@ -3664,3 +3664,57 @@ TEST_F(ModelFixture, Surface_SurfacePropertyOtherSideConditionsModel) {
   Model model;
   SurfacePropertyOtherSideConditionsModel otherSideModel(model);
 }
+
+TEST_F(ModelFixture, Surface_Triangulations) {
+  Model model;
+  Space space(model);
+
+  // a row of walls, every other one with a window
+  const unsigned n = 200;
+  std::vector<PlanarSurface> planarSurfaces;
+  std::vector<SubSurface> subSurfaces;
+  for (unsigned i = 0; i < n; ++i) {
+    double x = 10.0 * i;
+    Point3dVector points{Point3d(x, 0, 3), Point3d(x, 0, 0), Point3d(x + 10, 0, 0), Point3d(x + 10, 0, 3)};
+    Surface surface(points, model);
+    surface.setSpace(space);
+    planarSurfaces.push_back(surface);
+
+    if (i % 2 == 1) {
+      points = {Point3d(x + 1, 0, 2), Point3d(x + 1, 0, 1), Point3d(x + 9, 0, 1), Point3d(x + 9, 0, 2)};
+      SubSurface subSurface(points, model);
+      subSurface.setSurface(surface);
+      planarSurfaces.push_back(subSurface);
+      subSurfaces.push_back(subSurface);
+    }
+  }
+
+  std::vector<std::vector<std::vector<Point3d>>> triangulations = PlanarSurface::triangulations(planarSurfaces);
+  ASSERT_EQ(planarSurfaces.size(), triangulations.size());
+  for (size_t i = 0; i < planarSurfaces.size(); ++i) {
+    // cached by the batch call
+    EXPECT_EQ(triangulations[i], planarSurfaces[i].triangulation());
+    EXPECT_NEAR(planarSurfaces[i].netArea(), triangulatedArea(triangulations[i]), 0.0001);
+  }
+
+  // cached triangulation is updated when a sub surface moves or is removed
+  Surface surface = subSurfaces[0].surface().get();
+  EXPECT_NEAR(22.0, triangulatedArea(surface.triangulation()), 0.0001);
+  Point3dVector points = subSurfaces[0].vertices();
+  for (auto& point : points) {
+    point = Point3d(point.x(), point.y(), point.z() - 0.5);
+  }
+  EXPECT_TRUE(subSurfaces[0].setVertices(points));
+  std::vector<std::vector<Point3d>> triangulation = surface.triangulation();
+  EXPECT_NEAR(22.0, triangulatedArea(triangulation), 0.0001);
+  EXPECT_NE(triangulations[1], triangulation);
+
+  subSurfaces[0].remove();
+  EXPECT_NEAR(30.0, triangulatedArea(surface.triangulation()), 0.0001);
+  EXPECT_NEAR(30.0, triangulatedArea(PlanarSurface::triangulations({surface})[0]), 0.0001);
+
+  // and when the surface itself changes
+  points = {Point3d(10, 0, 2), Point3d(10, 0, 0), Point3d(20, 0, 0), Point3d(20, 0, 2)};
+  EXPECT_TRUE(surface.setVertices(points));
+  EXPECT_NEAR(20.0, triangulatedArea(surface.triangulation()), 0.0001);
+}
@@ -34,6 +34,8 @@
 #include "../TableMultiVariableLookup.hpp"
 #include "../TableMultiVariableLookup_Impl.hpp"
 
+#include <cmath>
+
 using namespace openstudio;
 using namespace openstudio::model;
 
@@ -328,4 +330,66 @@ TEST_F(ModelFixture, TableMultiVariablePointOrder2) {
   EXPECT_EQ(2, points[23].x()[1]);
   EXPECT_EQ(4, points[23].x()[2]);
   EXPECT_EQ(324, points[23].y());
-}
\ No newline at end of file
+}
+
+TEST_F(ModelFixture, TableMultiVariableLookup_evaluate) {
+  Model m;
+  TableMultiVariableLookup table(m, 2);
+
+  // y = 0.01 * x1 + 0.002 * x2^2, linear in x1 and quadratic in x2
+  auto calc = [](double x1, double x2) { return 0.01 * x1 + 0.002 * x2 * x2; };
+
+  std::vector<TableMultiVariableLookupPoint> points;
+  for (double x1 : {70.0, 72.0, 74.0, 76.0, 78.0}) {
+    for (double x2 : {32.0, 45.0, 68.0, 81.0, 94.0, 107.0}) {
+      points.push_back(TableMultiVariableLookupPoint(x1, x2, calc(x1, x2)));
+    }
+  }
+  EXPECT_TRUE(table.addPoints(points));
+  EXPECT_EQ(30u, table.points().size());
+
+  // duplicates are rejected, the other points are still added
+  std::vector<TableMultiVariableLookupPoint> morePoints{TableMultiVariableLookupPoint(70.0, 32.0, 1.0),
+                                                        TableMultiVariableLookupPoint(80.0, 32.0, calc(80.0, 32.0))};
+  EXPECT_FALSE(table.addPoints(morePoints));
+  EXPECT_EQ(31u, table.points().size());
+  EXPECT_TRUE(table.setPoints(points));
+  EXPECT_EQ(30u, table.points().size());
+
+  // x values within the tolerance of an existing point are duplicates too, whatever their sort order
+  EXPECT_FALSE(table.addPoints({TableMultiVariableLookupPoint(std::nextafter(70.0, 71.0), 32.0, 1.0)}));
+  EXPECT_FALSE(table.addPoints({TableMultiVariableLookupPoint(std::nextafter(72.0, 71.0), 107.0, 1.0)}));
+  EXPECT_EQ(30u, table.points().size());
+
+  // on the grid
+  EXPECT_DOUBLE_EQ(calc(72.0, 45.0), table.evaluate(std::vector<double>{72.0, 45.0}));
+
+  // Lagrange with 3 points is exact for a quadratic
+  EXPECT_TRUE(table.setInterpolationMethod("LagrangeInterpolationLinearExtrapolation"));
+  EXPECT_TRUE(table.setNumberofInterpolationPoints(3));
+  EXPECT_NEAR(calc(73.0, 50.0), table.evaluate(std::vector<double>{73.0, 50.0}), 1.0e-9);
+
+  // linear interpolation between grid nodes
+  EXPECT_TRUE(table.setInterpolationMethod("LinearInterpolationOfTable"));
+  double expected = 0.73 + (calc(0.0, 45.0) + (calc(0.0, 68.0) - calc(0.0, 45.0)) * 5.0 / 23.0);
+  EXPECT_NEAR(expected, table.evaluate(std::vector<double>{73.0, 50.0}), 1.0e-9);
+
+  // linear extrapolation beyond the table, unless limited
+  EXPECT_NEAR(calc(80.0, 32.0), table.evaluate(std::vector<double>{80.0, 32.0}), 1.0e-9);
+  EXPECT_TRUE(table.setMaximumValueofX1(78.0));
+  EXPECT_NEAR(calc(78.0, 32.0), table.evaluate(std::vector<double>{80.0, 32.0}), 1.0e-9);
+  EXPECT_TRUE(table.setMaximumTableOutput(3.0));
+  EXPECT_DOUBLE_EQ(3.0, table.evaluate(std::vector<double>{74.0, 107.0}));
+
+  // batch evaluation matches point by point evaluation
+  std::vector<std::vector<double>> xs{{70.0, 32.0}, {71.0, 40.0}, {75.5, 100.0}, {90.0, 20.0}};
+  std::vector<double> ys = table.evaluate(xs);
+  ASSERT_EQ(xs.size(), ys.size());
+  for (size_t i = 0; i < xs.size(); ++i) {
+    EXPECT_DOUBLE_EQ(table.evaluate(xs[i]), ys[i]);
+  }
+
+  // an incomplete grid cannot be evaluated
+  EXPECT_TRUE(table.addPoint(100.0, 32.0, 1.0));
+  EXPECT_DOUBLE_EQ(-9999.0, table.evaluate(std::vector<double>{72.0, 45.0}));
+}
@@ -44,8 +44,12 @@
 #include "../Construction.hpp"
 
 #include "../../utilities/geometry/ThreeJS.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+
+#include <json/json.h>
 
 #include <algorithm>
+#include <sstream>
 
 using namespace openstudio;
 using namespace openstudio::model;
@@ -154,3 +158,81 @@ TEST_F(ModelFixture, ThreeJSForwardTranslator_ConstructionAirBoundary) {
   EXPECT_FALSE(checkIfMaterialExist(materials, "Construction_Air_Boundary"));  // Instead it should have been skipped to be replace by "AirWall"
   EXPECT_TRUE(checkIfMaterialExist(materials, "AirWall"));
 }
+
+TEST_F(ModelFixture, ThreeJSForwardTranslator_Stream) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model = exampleModel();
+  ThreeScene scene = ft.modelToThreeJS(model, true);
+
+  std::stringstream ss;
+  ft.modelToThreeJS(model, true, ss);
+  EXPECT_EQ(0, ft.errors().size());
+
+  boost::optional<ThreeScene> streamed = ThreeScene::load(ss.str());
+  ASSERT_TRUE(streamed);
+  EXPECT_EQ(scene.geometries().size(), streamed->geometries().size());
+  EXPECT_EQ(scene.materials().size(), streamed->materials().size());
+  EXPECT_EQ(scene.object().children().size(), streamed->object().children().size());
+  ASSERT_FALSE(streamed->geometries().empty());
+  EXPECT_EQ(scene.geometries()[0].uuid(), streamed->geometries()[0].uuid());
+  EXPECT_EQ(scene.geometries()[0].data().vertices(), streamed->geometries()[0].data().vertices());
+  EXPECT_EQ(scene.geometries()[0].data().faces(), streamed->geometries()[0].data().faces());
+
+  std::stringstream json;
+  std::stringstream buffer;
+  ft.modelToThreeJSBinary(model, json, buffer);
+  EXPECT_EQ(0, ft.errors().size());
+
+  Json::CharReaderBuilder rbuilder;
+  std::string formattedErrors;
+  Json::Value root;
+  ASSERT_TRUE(Json::parseFromStream(rbuilder, json, &root, &formattedErrors));
+  EXPECT_EQ(buffer.str().size(), root["buffers"][0]["byteLength"].asUInt64());
+  ASSERT_EQ(scene.geometries().size(), root["geometries"].size());
+
+  // each triangle has 3 vertices with 3 position and 3 normal components
+  unsigned long long numTriangles = 0;
+  for (const auto& geometry : scene.geometries()) {
+    numTriangles += geometry.data().faces().size() / 4;
+  }
+  EXPECT_EQ(numTriangles * 3 * 6 * sizeof(float), buffer.str().size());
+
+  const Json::Value& position = root["geometries"][0]["data"]["attributes"]["position"];
+  EXPECT_EQ("Float32Array", position["type"].asString());
+  EXPECT_EQ(3u, position["itemSize"].asUInt());
+  EXPECT_EQ(scene.geometries()[0].data().faces().size() / 4 * 3, position["count"].asUInt());
+}
+
+TEST_F(ModelFixture, ThreeJSForwardTranslator_TriangulationErrors) {
+
+  ThreeJSForwardTranslator ft;
+
+  Model model;
+  Space space(model);
+
+  // self intersecting surfaces can not be triangulated, enough of them that some are triangulated on worker threads
+  const unsigned numBadSurfaces = 16;
+  for (unsigned i = 0; i < numBadSurfaces; ++i) {
+    double x = 10.0 * i;
+    std::vector<Point3d> vertices{Point3d(x, 1, 0), Point3d(x + 9, 8, 0), Point3d(x + 3, 0, 0), Point3d(x + 4, 5, 0), Point3d(x, 2, 0)};
+    Surface surface(vertices, model);
+    surface.setSpace(space);
+  }
+
+  ft.modelToThreeJS(model, true);
+
+  // errors logged while triangulating are reported along with the translator's own
+  unsigned numPartitionErrors = 0;
+  unsigned numTriangulateErrors = 0;
+  for (const auto& error : ft.errors()) {
+    if (error.logMessage() == "Failed to partition polygon") {
+      ++numPartitionErrors;
+    } else if (error.logMessage().find("Failed to triangulate surface") == 0) {
+      ++numTriangulateErrors;
+    }
+  }
+  EXPECT_EQ(numBadSurfaces, numPartitionErrors);
+  EXPECT_EQ(numBadSurfaces, numTriangulateErrors);
+}
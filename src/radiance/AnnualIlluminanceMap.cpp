@@ -30,18 +30,14 @@
 #include "AnnualIlluminanceMap.hpp"
 #include "HeaderInfo.hpp"
 
+#include "../utilities/core/StringHelpers.hpp"
+
+#include <cctype>
 #include <iostream>
 #include <fstream>
 #include <vector>
 
-#include <boost/lexical_cast.hpp>
-#include <boost/regex.hpp>
-
-#include <boost/algorithm/string.hpp>
-#include <boost/tokenizer.hpp>
-
 using namespace std;
-using namespace boost;
 using namespace openstudio;
 
 namespace openstudio {
@@ -78,15 +74,12 @@ namespace radiance {
     // lines 1 and 2 are the header lines
     string line1, line2;
 
-    // this will contain matches to regular expressions
-    smatch matches;
-
-    // matches a single number followed by either tabs or spaces
-    const regex singleNumber("([-+]?[0-9]*\\.?[0-9]+)[\\s\\t]*");
-
     // conversion from footcandles to lux
     const double footcandlesToLux(10.76);
 
+    // numbers parsed from the current line, reused across lines
+    vector<double> lineValues;
+
     // read the rest of the file line by line
     while (getline(file, line)) {
       ++lineNum;
@@ -111,50 +104,62 @@ namespace radiance {
         M = m_xVector.size();
         N = m_yVector.size();
 
+        lineValues.reserve(6 + M * N);
+
       } else {
 
         // each line contains the month, day, time (in hours),
         // Solar Azimuth(degrees from south), Solar Altitude(degrees), Global Horizontal Illuminance (fc)
         // followed by M*N illuminance points
 
-        // break the line up by spaces
-        vector<string> lineVector;
-        tokenizer<char_separator<char>, std::string::const_iterator, std::string> tk(line, char_separator<char>(" "));
-        for (tokenizer<char_separator<char>, std::string::const_iterator, std::string>::iterator it(tk.begin()); it != tk.end(); ++it) {
-          lineVector.push_back(*it);
+        // parse the numbers separated by whitespace, the file always uses '.' as the decimal separator
+        lineValues.clear();
+        const char* token = line.c_str();
+        const char* lineEnd = token + line.size();
+        while (token != lineEnd) {
+          if (isspace(static_cast<unsigned char>(*token))) {
+            ++token;
+            continue;
+          }
+          const char* tokenEnd = token;
+          while ((tokenEnd != lineEnd) && !isspace(static_cast<unsigned char>(*tokenEnd))) {
+            ++tokenEnd;
+          }
+          double value;
+          if (!string_conversions::parse(token, tokenEnd, value)) {
+            LOG(Fatal, "Could not read illuminance value '" << string(token, tokenEnd) << "' on line " << lineNum << ".");
+            return;
+          }
+          lineValues.push_back(value);
+          token = tokenEnd;
         }
 
         // total number minus 6 standard header items
-        unsigned numValues = lineVector.size() - 6;
+        unsigned numValues = (lineValues.size() < 6) ? 0 : lineValues.size() - 6;
 
-        if (numValues != M * N) {
+        if ((lineValues.size() < 6) || (numValues != M * N)) {
           LOG(Fatal, "Incorrect number of illuminance values read " << numValues << ", expecting " << M * N << ".");
           return;
         } else {
 
-          MonthOfYear thisMonth = monthOfYear(lexical_cast<unsigned>(lineVector[0]));
-          unsigned day = lexical_cast<unsigned>(lineVector[1]);
-          double fracDays = lexical_cast<double>(lineVector[2]) / 24.0;
+          MonthOfYear thisMonth = monthOfYear(static_cast<unsigned>(lineValues[0]));
+          unsigned day = static_cast<unsigned>(lineValues[1]);
+          double fracDays = lineValues[2] / 24.0;
 
           // ignore solar angles and global horizontal for now
 
           // make the date time
           DateTime dateTime(Date(thisMonth, day), Time(fracDays));
 
-          // matrix we are going to read in
-          Matrix illuminanceMap(M, N);
-
-          // read in the values
-          unsigned index = 6;
-          for (unsigned j = 0; j < N; ++j) {
-            for (unsigned i = 0; i < M; ++i) {
-              illuminanceMap(i, j) = footcandlesToLux * lexical_cast<double>(lineVector[index]);
-              ++index;
-            }
+          // append the values, stored in file order (x varies fastest)
+          size_t index = m_dateTimes.size();
+          m_illuminanceValues.reserve(m_illuminanceValues.size() + M * N);
+          for (auto it = lineValues.begin() + 6; it != lineValues.end(); ++it) {
+            m_illuminanceValues.push_back(footcandlesToLux * (*it));
           }
 
           m_dateTimes.push_back(dateTime);
-          m_dateTimeIlluminanceMap[dateTime] = illuminanceMap;
+          m_dateTimeIndexMap[dateTime.toEpoch()] = index;
         }
       }
     }
@@ -165,9 +170,19 @@ namespace radiance {
 
   /// get the illuminance map in lux corresponding to date and time
   openstudio::Matrix AnnualIlluminanceMap::illuminanceMap(const openstudio::DateTime& dateTime) const {
-    auto it = m_dateTimeIlluminanceMap.find(dateTime);
-    if (it != m_dateTimeIlluminanceMap.end()) {
-      return it->second;
+    auto it = m_dateTimeIndexMap.find(dateTime.toEpoch());
+    if (it != m_dateTimeIndexMap.end()) {
+      unsigned M = m_xVector.size();
+      unsigned N = m_yVector.size();
+      Matrix result(M, N);
+      auto value = m_illuminanceValues.begin() + it->second * M * N;
+      for (unsigned j = 0; j < N; ++j) {
+        for (unsigned i = 0; i < M; ++i) {
+          result(i, j) = *value;
+          ++value;
+        }
+      }
+      return result;
     }
 
     return m_nullIlluminanceMap;
@@ -38,18 +38,23 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/Path.hpp"
 
+#include <ctime>
+#include <unordered_map>
+
 namespace openstudio {
 namespace radiance {
 
   /** AnnualIlluminanceMap represents illuminance map for an entire year.
   *   We assume that the output files is from SPOT, with length in meters and illuminance
   *   values in footcandles.  All illuminance values are converted to lux.
+  *   Values for all timesteps are stored in a single contiguous array, an illuminance Matrix
+  *   is only created when requested.
   */
   class RADIANCE_API AnnualIlluminanceMap
   {
    private:
-    // map of DateTime to Matrix (illuminance map)
-    typedef std::map<openstudio::DateTime, openstudio::Matrix> DateTimeIlluminanceMap;
+    // map of DateTime, keyed by DateTime::toEpoch as in DateTime::operator==, to timestep index in m_illuminanceValues
+    typedef std::unordered_map<std::time_t, size_t> DateTimeIndexMap;
 
    public:
     /// default constructor
@@ -89,7 +94,9 @@ namespace radiance {
     openstudio::Vector m_xVector;
     openstudio::Vector m_yVector;
     openstudio::Matrix m_nullIlluminanceMap;  // used when there is no data
-    DateTimeIlluminanceMap m_dateTimeIlluminanceMap;
+    DateTimeIndexMap m_dateTimeIndexMap;
+    // illuminance in lux, one block of x * y values per timestep with x varying fastest
+    std::vector<double> m_illuminanceValues;
   };
 
 }  // namespace radiance
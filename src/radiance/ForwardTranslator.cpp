@@ -166,9 +166,8 @@ namespace radiance {
   }
 
   std::vector<openstudio::path> ForwardTranslator::translateModel(const openstudio::path& outPath, const openstudio::model::Model& model) {
-    m_model = model.clone(true).cast<openstudio::model::Model>();
-
-    m_model.purgeUnusedResourceObjects();
+    // the model is only read, objects that can not be translated are skipped rather than removed from a copy
+    m_model = model;
 
     m_logSink.setThreadId(std::this_thread::get_id());
 
@@ -182,32 +181,31 @@ namespace radiance {
 
     // preprocess the model here
     unsigned numSpacesToSimulate = 0;
-    for (openstudio::model::Space space : m_model.getConcreteModelObjects<openstudio::model::Space>()) {
+    std::vector<openstudio::model::Space> spaces;
+    for (const openstudio::model::Space& space : m_model.getConcreteModelObjects<openstudio::model::Space>()) {
 
-      // remove any spaces not associated with a thermal zone
+      // skip any spaces not associated with a thermal zone
       boost::optional<openstudio::model::ThermalZone> thermalZone = space.thermalZone();
       if (!thermalZone) {
         LOG(Error, "Model translation failure; space " << space.name().get() << " is not associated with a ThermalZone, could not be translated.");
-        space.remove();
         continue;
       }
+      spaces.push_back(space);
 
       // only allow assigned primary daylighting control points (as defined in thermal zone) through
-      for (openstudio::model::DaylightingControl daylightingControl : space.daylightingControls()) {
+      std::vector<openstudio::model::DaylightingControl> daylightingControls;
+      for (const openstudio::model::DaylightingControl& daylightingControl : space.daylightingControls()) {
         if (daylightingControl.isPrimaryDaylightingControl()) {
-          // ok
+          daylightingControls.push_back(daylightingControl);
         } else if (daylightingControl.isSecondaryDaylightingControl()) {
           LOG(Warn,
               "Secondary DaylightingControl " << daylightingControl.name().get() << " is not supported by Radiance, it will not be translated.");
-          daylightingControl.remove();
         } else {
           LOG(Warn, "DaylightingControl " << daylightingControl.name().get()
                                           << " is not associated with this Space's ThermalZone, it will not be translated.");
-          daylightingControl.remove();
         }
       }
 
-      std::vector<openstudio::model::DaylightingControl> daylightingControls = space.daylightingControls();
       std::vector<openstudio::model::IlluminanceMap> illuminanceMaps = space.illuminanceMaps();
       std::vector<openstudio::model::GlareSensor> glareSensors = space.glareSensors();
 
@@ -220,8 +218,8 @@ namespace radiance {
       }
     }
 
-    // remove unsupported shading controls
-    for (auto& shadingControl : model.getConcreteModelObjects<openstudio::model::ShadingControl>()) {
+    // skip unsupported shading controls
+    for (const auto& shadingControl : m_model.getConcreteModelObjects<openstudio::model::ShadingControl>()) {
       std::string shadingType = shadingControl.shadingType();
       bool supported = false;
       if (istringEqual("InteriorShade", shadingType)) {
@@ -248,8 +246,8 @@ namespace radiance {
       }
 
       if (!supported) {
-        LOG(Warn, "Removing ShadingControl '" << shadingControl.name().get() << "' with unsupported shadingType '" << shadingType << "'");
-        shadingControl.remove();
+        LOG(Warn, "Skipping ShadingControl '" << shadingControl.name().get() << "' with unsupported shadingType '" << shadingType << "'");
+        m_unsupportedShadingControls.insert(shadingControl.handle());
         continue;
       }
 
@@ -288,23 +286,28 @@ namespace radiance {
       openstudio::filesystem::create_directory(radDir / openstudio::toPath("bsdf"));
       openstudio::filesystem::create_directory(radDir / openstudio::toPath("skies"));
 
-      // get the building
-      openstudio::model::Building building = m_model.getUniqueModelObject<openstudio::model::Building>();
-
-      // get the site
-      openstudio::model::Site site = m_model.getUniqueModelObject<openstudio::model::Site>();
-
-      // get site and building shading
+      // get site and building shading, as returned by Site::shadingSurfaceGroups and Building::shadingSurfaceGroups
+      // without creating the Site or Building objects in the model
       LOG(Debug, "Processing site/building shading elements...");
+      std::vector<openstudio::model::ShadingSurfaceGroup> buildingShading;
+      std::vector<openstudio::model::ShadingSurfaceGroup> siteShading;
+      for (const auto& shadingSurfaceGroup : m_model.getConcreteModelObjects<openstudio::model::ShadingSurfaceGroup>()) {
+        std::string shadingSurfaceType = shadingSurfaceGroup.shadingSurfaceType();
+        if (istringEqual("Building", shadingSurfaceType)) {
+          buildingShading.push_back(shadingSurfaceGroup);
+        } else if (istringEqual("Site", shadingSurfaceType)) {
+          siteShading.push_back(shadingSurfaceGroup);
+        }
+      }
 
       // get building shading
-      buildingShadingSurfaceGroups(radDir, building.shadingSurfaceGroups(), outfiles);
+      buildingShadingSurfaceGroups(radDir, buildingShading, outfiles);
 
       // get site shading
-      siteShadingSurfaceGroups(radDir, site.shadingSurfaceGroups(), outfiles);
+      siteShadingSurfaceGroups(radDir, siteShading, outfiles);
 
       // get spaces
-      buildingSpaces(radDir, building.spaces(), outfiles);
+      buildingSpaces(radDir, spaces, outfiles);
 
       // write options files
       std::string dcmatsStringin;
@@ -329,7 +332,7 @@ namespace radiance {
       //    std::string dcmatsString = dcmatsStringin.gsub(',', ' ');
 
       // get Radiance sim settings
-      openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
+      openstudio::model::RadianceParameters radianceParameters = getRadianceParameters();
 
       // write Radiance options to file(s)
 
@@ -820,6 +823,21 @@ namespace radiance {
     m_radViewPoints.clear();
     m_radWindowGroups.clear();
     m_radWindowGroupShades.clear();
+
+    m_unsupportedShadingControls.clear();
+    m_defaultsModel.reset();
+  }
+
+  openstudio::model::RadianceParameters ForwardTranslator::getRadianceParameters() {
+    if (boost::optional<openstudio::model::RadianceParameters> radianceParameters =
+          m_model.getOptionalUniqueModelObject<openstudio::model::RadianceParameters>()) {
+      return *radianceParameters;
+    }
+    // use default parameters without adding the object to the model being translated
+    if (!m_defaultsModel) {
+      m_defaultsModel = openstudio::model::Model();
+    }
+    return m_defaultsModel->getUniqueModelObject<openstudio::model::RadianceParameters>();
   }
 
   WindowGroup ForwardTranslator::getWindowGroup(const openstudio::Vector3d& outwardNormal, const model::Space& space,
@@ -1027,7 +1045,8 @@ namespace radiance {
       LOG(Debug, "Processing space: " << space_name);
 
       // split model into zone-based Radiance .rad files
-      m_radSpaces[space_name] = "#\n# geometry file for space: " + space_name + "\n#\n\n";
+      std::string& radSpace = m_radSpaces[space_name];
+      radSpace = "#\n# geometry file for space: " + space_name + "\n#\n\n";
 
       // loop over surfaces in space
 
@@ -1043,11 +1062,11 @@ namespace radiance {
         std::string surface_name = cleanName(surface.name().get());
 
         // add surface to space geometry
-        m_radSpaces[space_name] += "# surface: " + surface_name + "\n";
+        radSpace += "# surface: " + surface_name + "\n";
 
         // set construction of surface
         std::string constructionName = surface.getString(2).get();
-        m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+        radSpace += "# construction: " + constructionName + "\n";
 
         // get reflectances
         double interiorVisibleReflectance = 0.5;  // default for space surfaces
@@ -1061,16 +1080,23 @@ namespace radiance {
           exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
         }
 
+        // surfaces adjacent to a space that is not translated (no thermal zone) are treated as exterior
+        bool hasAdjacentSurface = false;
+        if (boost::optional<openstudio::model::Surface> adjacentSurface = surface.adjacentSurface()) {
+          boost::optional<openstudio::model::Space> adjacentSpace = adjacentSurface->space();
+          hasAdjacentSurface = adjacentSpace && adjacentSpace->thermalZone();
+        }
+
         // create polygon object
         openstudio::Point3dVectorVector polygons = openstudio::radiance::ForwardTranslator::getPolygons(surface);
         for (const openstudio::Point3dVector& polygon : polygons) {
 
-          if (!surface.adjacentSurface()) {
+          if (!hasAdjacentSurface) {
             // 2-sided material
 
             // header
-            m_radSpaces[space_name] += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
-                                       + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+            radSpace += "# reflectance (int) = " + formatString(interiorVisibleReflectance, 3)
+                        + "\n# reflectance (ext) = " + formatString(exteriorVisibleReflectance, 3) + "\n";
 
             // material definition
 
@@ -1088,14 +1114,13 @@ namespace radiance {
                                      + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
             // polygon reference
-            m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                       + formatString(exteriorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
+            radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3)
+                        + " polygon " + surface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
           } else {
             // interior-only material
 
             // header
-            m_radSpaces[space_name] += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+            radSpace += "# reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
             // material definition
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
@@ -1103,15 +1128,15 @@ namespace radiance {
                                   + formatString(interiorVisibleReflectance, 3) + " 0 0\n");
 
             // polygon reference
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
-                                       + formatString(polygon.size() * 3) + "\n";
+            radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + surface_name + "\n0\n0\n"
+                        + formatString(polygon.size() * 3) + "\n";
           };
 
           // add polygon vertices
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          radSpace += "\n";
         }
         // end(surface)
 
@@ -1151,9 +1176,11 @@ namespace radiance {
 
             // TODO: This is going to need update!
             boost::optional<model::ShadingControl> shadingControl;
-            auto scs = subSurface.shadingControls();
-            if (!scs.empty()) {
-              shadingControl = scs[0];
+            for (const auto& sc : subSurface.shadingControls()) {
+              if (m_unsupportedShadingControls.find(sc.handle()) == m_unsupportedShadingControls.end()) {
+                shadingControl = sc;
+                break;
+              }
             }
 
             // future support for mullion factor
@@ -1357,20 +1384,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(exteriorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(exteriorVisibleReflectance, 3) + " " + formatString(exteriorVisibleReflectance, 3) + " "
                                         + formatString(exteriorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(exteriorVisibleReflectance, 3) + " polygon outside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 // make interior sill/reveal surfaces
@@ -1387,20 +1414,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                         + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_reveal_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
 
                 if (insideSillDepth && (*insideSillDepth > 0.0)) {
@@ -1416,20 +1443,20 @@ namespace radiance {
                   double interiorVisibleReflectance = 0.5;
                   double exteriorVisibleReflectance = 0.2;
                   //polygon header
-                  m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-                  m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+                  radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance, 3) + "\n";
                   // write material
                   m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                         + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                         + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
                   // write polygon
-                  m_radSpaces[space_name] +=
+                  radSpace +=
                     "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon inside_sill_" + subSurface_name + std::to_string(i) + "\n";
-                  m_radSpaces[space_name] += "0\n0\n" + formatString(4 * 3) + "\n";
-                  m_radSpaces[space_name] += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
-                  m_radSpaces[space_name] += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
+                  radSpace += "0\n0\n" + formatString(4 * 3) + "\n";
+                  radSpace += formatString(vertex1.x()) + " " + formatString(vertex1.y()) + " " + formatString(vertex1.z()) + "\n\n";
+                  radSpace += formatString(vertex2.x()) + " " + formatString(vertex2.y()) + " " + formatString(vertex2.z()) + "\n\n";
+                  radSpace += formatString(vertex3.x()) + " " + formatString(vertex3.y()) + " " + formatString(vertex3.z()) + "\n\n";
+                  radSpace += formatString(vertex4.x()) + " " + formatString(vertex4.y()) + " " + formatString(vertex4.z()) + "\n\n";
                 }
               }
             }
@@ -1659,18 +1686,18 @@ namespace radiance {
             double interiorVisibleReflectance = 1.0 - interiorVisibleAbsorptance;
             double exteriorVisibleReflectance = 1.0 - exteriorVisibleAbsorptance;
             //polygon header
-            m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-            m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+            radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+            radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
             // write material
             m_radMaterials.insert("void plastic refl_" + formatString(interiorVisibleReflectance, 3) + "\n0\n0\n5\n"
                                   + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                   + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
             // write polygon
-            m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
-            m_radSpaces[space_name] += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
+            radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + subSurface_name + "\n";
+            radSpace += "0\n0\n" + formatString(polygon.size() * 3) + "\n\n";
 
             for (const auto& vertex : polygon) {
-              m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+              radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
             }
 
           } else if (subSurfaceUpCase == "TUBULARDAYLIGHTDOME") {
@@ -1695,11 +1722,11 @@ namespace radiance {
           std::string shadingSurface_name = cleanName(shadingSurface.name().get());
 
           // add surface to zone geometry
-          m_radSpaces[space_name] += "# surface: " + shadingSurface_name + "\n";
+          radSpace += "# surface: " + shadingSurface_name + "\n";
 
           // set construction of space shadingSurface
           std::string constructionName = shadingSurface.getString(2).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.25;  // default for space shading surfaces
@@ -1730,20 +1757,19 @@ namespace radiance {
                                    + " " + "refl_" + formatString(interiorVisibleReflectance, 3) + " if(Rdot,1,0) .\n0\n0\n\n");
 
           // polygon header
-          m_radSpaces[space_name] += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "# exterior visible reflectance: " + formatString(exteriorVisibleReflectance, 3) + "\n";
+          radSpace += "# interior visible reflectance: " + formatString(interiorVisibleReflectance, 3) + "\n";
 
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(shadingSurface);
-          m_radSpaces[space_name] += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_"
-                                     + formatString(exteriorVisibleReflectance, 3) + " polygon " + shadingSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
+          radSpace += "reflBACK_" + formatString(interiorVisibleReflectance, 3) + "_reflFRONT_" + formatString(exteriorVisibleReflectance, 3)
+                      + " polygon " + shadingSurface_name + "\n0\n0\n" + formatString(polygon.size() * 3) + "\n";
 
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
+            radSpace += "" + formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n";
           }
-          m_radSpaces[space_name] += "\n";
+          radSpace += "\n";
         }
       }  // end shading surfaces
 
@@ -1770,11 +1796,11 @@ namespace radiance {
 
           // add surface to zone geometry
 
-          m_radSpaces[space_name] += "# surface: " + interiorPartitionSurface_name + "\n";
+          radSpace += "# surface: " + interiorPartitionSurface_name + "\n";
 
           // set construction of interiorPartitionSurface
           std::string constructionName = interiorPartitionSurface.getString(1).get();
-          m_radSpaces[space_name] += "# construction: " + constructionName + "\n";
+          radSpace += "# construction: " + constructionName + "\n";
 
           // get reflectance
           double interiorVisibleReflectance = 0.5;  // set some default
@@ -1794,15 +1820,15 @@ namespace radiance {
                                 + formatString(interiorVisibleReflectance, 3) + " " + formatString(interiorVisibleReflectance, 3) + " "
                                 + formatString(interiorVisibleReflectance, 3) + " 0 0\n\n");
           // polygon header
-          m_radSpaces[space_name] += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
-          m_radSpaces[space_name] += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
+          radSpace += "#--interiorVisibleReflectance = " + formatString(interiorVisibleReflectance, 3) + "\n";
+          radSpace += "#--exteriorVisibleReflectance = " + formatString(exteriorVisibleReflectance) + "\n";
           // get / write surface polygon
 
           openstudio::Point3dVector polygon = openstudio::radiance::ForwardTranslator::getPolygon(interiorPartitionSurface);
-          m_radSpaces[space_name] += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
-                                     + formatString(polygon.size() * 3) + "\n";
+          radSpace += "refl_" + formatString(interiorVisibleReflectance, 3) + " polygon " + interiorPartitionSurface_name + "\n0\n0\n"
+                      + formatString(polygon.size() * 3) + "\n";
           for (const auto& vertex : polygon) {
-            m_radSpaces[space_name] += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
+            radSpace += formatString(vertex.x()) + " " + formatString(vertex.y()) + " " + formatString(vertex.z()) + "\n\n";
           }
         }
       }  // end interior partitions
@@ -1820,6 +1846,11 @@ namespace radiance {
       std::vector<openstudio::model::DaylightingControl> daylightingControls = space.daylightingControls();
       for (const auto& control : daylightingControls) {
 
+        // only primary daylighting controls are translated, see translateModel
+        if (!control.isPrimaryDaylightingControl()) {
+          continue;
+        }
+
         m_radSensors[space_name] = "";
 
         openstudio::Point3d sensor_point = openstudio::radiance::ForwardTranslator::getReferencePoint(control);
@@ -1965,7 +1996,7 @@ namespace radiance {
       if (file.is_open()) {
         t_outfiles.push_back(filename);
         m_radSceneFiles.push_back(filename);
-        file << m_radSpaces[space_name];
+        file << radSpace;
       } else {
         LOG(Error, "Cannot open file '" << toString(filename) << "' for writing");
       }
@@ -1977,7 +2008,7 @@ namespace radiance {
         if (m_radWindowGroups.find(windowGroup_name) != m_radWindowGroups.end()) {
 
           // get the Radiance parameters... so we have them.
-          openstudio::model::RadianceParameters radianceParameters = m_model.getUniqueModelObject<openstudio::model::RadianceParameters>();
+          openstudio::model::RadianceParameters radianceParameters = getRadianceParameters();
           if (windowGroup_name != "WG0") {
             if (radianceParameters.skyDiscretizationResolution() == "146") {
               LOG(Info, "writing out window group '" + windowGroup_name + "', using Klems sampling basis.");
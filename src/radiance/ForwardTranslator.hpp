@@ -42,6 +42,7 @@
 #include "../model/DaylightingControl.hpp"
 #include "../model/IlluminanceMap.hpp"
 #include "../model/GlareSensor.hpp"
+#include "../model/RadianceParameters.hpp"
 
 #include "../utilities/geometry/Point3d.hpp"
 #include "../utilities/geometry/Vector3d.hpp"
@@ -123,10 +124,18 @@ namespace radiance {
     static double PI() {
       return 3.14159265358979323;
     }
+    // model being translated, it is not modified
     openstudio::model::Model m_model;
 
     void clear();
 
+    // the model's RadianceParameters, or default parameters if it has none
+    openstudio::model::RadianceParameters getRadianceParameters();
+    boost::optional<openstudio::model::Model> m_defaultsModel;
+
+    // shading controls with a shading type that is not supported, these are ignored
+    std::set<openstudio::Handle> m_unsupportedShadingControls;
+
     // create materials library for model, shared for all Spaces
     std::set<std::string> m_radMaterials;
     std::set<std::string> m_radMixMaterials;
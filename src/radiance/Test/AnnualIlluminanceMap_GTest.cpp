@@ -73,3 +73,41 @@ AnnualIlluminanceMap RadAnnualIlluminanceMapFixture::outFile;
 ///////////////////////////////////////////////////////////////////////////////
 
 TEST_F(RadAnnualIlluminanceMapFixture, AnnualIlluminanceMap) {}
+
+TEST(AnnualIlluminanceMap, Parse) {
+  openstudio::path path = toPath("./AnnualIlluminanceMap_Parse.ill");
+  {
+    openstudio::filesystem::ofstream file(path);
+    ASSERT_TRUE(file.is_open());
+    // origin, max x and max y, then x spacing, y spacing and offset: 3 x points and 2 y points
+    file << "0 0 0 2 0 0 0 1 0" << std::endl;
+    file << "1 1 0" << std::endl;
+    file << "1 1 12 0 45 100 1 2 3 4 5 6" << std::endl;
+    file << "1 1 13.5 0 45 100 10 20 30 40 50 60" << std::endl;
+    file.close();
+  }
+
+  AnnualIlluminanceMap map(path);
+  ASSERT_EQ(3u, map.xVector().size());
+  ASSERT_EQ(2u, map.yVector().size());
+
+  std::vector<openstudio::DateTime> dateTimes = map.dateTimes();
+  ASSERT_EQ(2u, dateTimes.size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 12)), dateTimes[0]);
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 1), openstudio::Time(0, 13, 30)), dateTimes[1]);
+
+  // x varies fastest in the file, values are converted from footcandles to lux
+  openstudio::Matrix illuminance = map.illuminanceMap(dateTimes[1]);
+  ASSERT_EQ(3u, illuminance.size1());
+  ASSERT_EQ(2u, illuminance.size2());
+  EXPECT_DOUBLE_EQ(10.76 * 10, illuminance(0, 0));
+  EXPECT_DOUBLE_EQ(10.76 * 30, illuminance(2, 0));
+  EXPECT_DOUBLE_EQ(10.76 * 40, illuminance(0, 1));
+  EXPECT_DOUBLE_EQ(10.76 * 60, illuminance(2, 1));
+
+  // no data for this date time
+  illuminance = map.illuminanceMap(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear::Jan, 2), openstudio::Time(0, 12)));
+  EXPECT_EQ(0u, illuminance.size1());
+
+  openstudio::filesystem::remove(path);
+}
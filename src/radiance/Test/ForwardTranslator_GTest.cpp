@@ -39,6 +39,8 @@
 #include "../../model/SubSurface.hpp"
 #include "../../model/SubSurface_Impl.hpp"
 #include "../../model/ShadingControl.hpp"
+#include "../../model/RadianceParameters.hpp"
+#include "../../model/RadianceParameters_Impl.hpp"
 #include "../../model/Construction.hpp"
 #include "../../model/Construction_Impl.hpp"
 #include "../../model/DaylightingControl.hpp"
@@ -249,6 +251,39 @@ TEST(Radiance, ForwardTranslator_ExampleModelWithShadingControl) {
   EXPECT_TRUE(ft.warnings().empty()) << printLogMessages(ft.warnings());
 }
 
+TEST(Radiance, ForwardTranslator_ExampleModel_ModelNotModified) {
+  Model model = exampleModel();
+  Construction shadedConstruction(model);
+
+  // unsupported shading type, ignored by the translator
+  model::ShadingControl shadingControl(shadedConstruction);
+  EXPECT_TRUE(shadingControl.setShadingType("ExteriorScreen"));
+  for (auto& subSurface : model.getConcreteModelObjects<model::SubSurface>()) {
+    if (istringEqual(subSurface.subSurfaceType(), "FixedWindow") || istringEqual(subSurface.subSurfaceType(), "OperableWindow")) {
+      subSurface.setShadingControl(shadingControl);
+    }
+  }
+
+  unsigned numObjects = model.numObjects();
+  bool hasRadianceParameters = model.getOptionalUniqueModelObject<RadianceParameters>().is_initialized();
+
+  openstudio::path outpath = toPath("./ForwardTranslator_ExampleModel_ModelNotModified");
+  openstudio::filesystem::remove_all(outpath);
+  ASSERT_FALSE(openstudio::filesystem::exists(outpath));
+
+  ForwardTranslator ft;
+  std::vector<path> outpaths = ft.translateModel(outpath, model);
+  EXPECT_TRUE(openstudio::filesystem::exists(outpath));
+  EXPECT_FALSE(outpaths.empty()) << printPaths(outpaths);
+  EXPECT_TRUE(ft.errors().empty()) << printLogMessages(ft.errors());
+  EXPECT_FALSE(ft.warnings().empty());
+
+  // translation reads the model, it does not add or remove objects
+  EXPECT_EQ(numObjects, model.numObjects());
+  EXPECT_TRUE(shadingControl.initialized());
+  EXPECT_EQ(hasRadianceParameters, model.getOptionalUniqueModelObject<RadianceParameters>().is_initialized());
+}
+
 TEST(Radiance, ForwardTranslator_ExampleModel_NoIllumMaps) {
   Model model = exampleModel();
 
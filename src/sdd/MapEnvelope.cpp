@@ -98,7 +98,7 @@ namespace sdd {
       std::vector<model::Material> materials;
       for (const pugi::xml_node& materialElement : element.children("MatRef")) {
         std::string materialName = escapeName(materialElement.text().as_string());
-        boost::optional<model::Material> material = model.getModelObjectByName<model::Material>(materialName);
+        boost::optional<model::Material> material = getModelObjectByName<model::Material>(model, materialName);
         if (!material) {
           LOG(Error, "Construction: " << construction.name().get() << " references material: " << materialName << " that is not defined.");
 
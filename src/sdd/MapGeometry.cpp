@@ -378,7 +378,7 @@ namespace sdd {
       }
     }
 
-    boost::optional<model::Space> space = buildingStory.model().getModelObjectByName<model::Space>(spaceName);
+    boost::optional<model::Space> space = getModelObjectByName<model::Space>(buildingStory.model(), spaceName);
     if (!space) {
       LOG(Error, "Could not retrieve Space named '" << spaceName << "'.");
       return boost::none;
@@ -394,7 +394,7 @@ namespace sdd {
       thermalZoneName = escapeName(thermalZoneElement.text().as_string());
     }
 
-    boost::optional<model::ThermalZone> thermalZone = space->model().getModelObjectByName<model::ThermalZone>(thermalZoneName);
+    boost::optional<model::ThermalZone> thermalZone = getModelObjectByName<model::ThermalZone>(space->model(), thermalZoneName);
     if (thermalZone) {
       space->setThermalZone(*thermalZone);
     } else {
@@ -529,7 +529,7 @@ namespace sdd {
 
       equipment.setName(spaceName + " Water Use Equipment");
 
-      if (boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(hotWtrHtgSchRefElement.text().as_string())) {
+      if (boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, hotWtrHtgSchRefElement.text().as_string())) {
         equipment.setFlowRateFractionSchedule(schedule.get());
       }
 
@@ -621,7 +621,7 @@ namespace sdd {
 
           if (occSchRefElement) {
             std::string scheduleName = escapeName(occSchRefElement.text().as_string());
-            boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
             if (schedule) {
               people.setNumberofPeopleSchedule(*schedule);
             } else {
@@ -703,7 +703,7 @@ namespace sdd {
 
             if (infSchRefElement) {
               std::string scheduleName = escapeName(infSchRefElement.text().as_string());
-              boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+              boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
               if (schedule) {
                 spaceInfiltrationDesignFlowRate.setSchedule(*schedule);
               } else {
@@ -784,7 +784,7 @@ namespace sdd {
 
         if (intLtgRegSchRefElement) {
           std::string scheduleName = escapeName(intLtgRegSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             lights.setSchedule(*schedule);
           } else {
@@ -835,7 +835,7 @@ namespace sdd {
 
         if (intLtgNonRegSchRefElement) {
           std::string scheduleName = escapeName(intLtgNonRegSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             lights.setSchedule(*schedule);
           } else {
@@ -901,7 +901,7 @@ namespace sdd {
 
         if (recptPwrDensSchRefElement) {
           std::string scheduleName = escapeName(recptPwrDensSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             electricEquipment.setSchedule(*schedule);
           } else {
@@ -953,7 +953,7 @@ namespace sdd {
 
         if (gasEqpPwrDensSchRefElement) {
           std::string scheduleName = escapeName(gasEqpPwrDensSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             gasEquipment.setSchedule(*schedule);
           } else {
@@ -1004,7 +1004,7 @@ namespace sdd {
 
         if (procElecSchRefElement) {
           std::string scheduleName = escapeName(procElecSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             electricEquipment.setSchedule(*schedule);
           } else {
@@ -1055,7 +1055,7 @@ namespace sdd {
 
         if (commRfrgEqpSchRefElement) {
           std::string scheduleName = escapeName(commRfrgEqpSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             electricEquipment.setSchedule(*schedule);
           } else {
@@ -1101,7 +1101,7 @@ namespace sdd {
 
         if (elevSchRefElement) {
           std::string scheduleName = escapeName(elevSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             electricEquipment.setSchedule(*schedule);
           } else {
@@ -1147,7 +1147,7 @@ namespace sdd {
 
         if (escalSchRefElement) {
           std::string scheduleName = escapeName(escalSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             electricEquipment.setSchedule(*schedule);
           } else {
@@ -1198,7 +1198,7 @@ namespace sdd {
 
         if (procGasSchRefElement) {
           std::string scheduleName = escapeName(procGasSchRefElement.text().as_string());
-          boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+          boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
           if (schedule) {
             gasEquipment.setSchedule(*schedule);
           } else {
@@ -1339,7 +1339,7 @@ namespace sdd {
     pugi::xml_node constructionReferenceElement = element.child("ConsAssmRef");
     if (constructionReferenceElement) {
       std::string constructionName = escapeName(constructionReferenceElement.text().as_string());
-      boost::optional<model::ConstructionBase> construction = space.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+      boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(space.model(), constructionName);
       if (construction) {
         surface.setConstruction(*construction);
       } else {
@@ -1468,7 +1468,7 @@ namespace sdd {
     pugi::xml_node adjacentSpaceElement = element.child("AdjacentSpcRef");
     if (adjacentSpaceElement) {
       std::string adjacentSpaceName = escapeName(adjacentSpaceElement.text().as_string());
-      boost::optional<model::Space> otherSpace = space.model().getModelObjectByName<model::Space>(adjacentSpaceName);
+      boost::optional<model::Space> otherSpace = getModelObjectByName<model::Space>(space.model(), adjacentSpaceName);
 
       if (!otherSpace) {
         LOG(Error, "Cannot retrieve adjacent Space '" << adjacentSpaceName << "' for Surface named '" << name << "'");
@@ -1573,7 +1573,7 @@ namespace sdd {
       pugi::xml_node constructionReferenceElement = element.child("FenConsRef");
       if (constructionReferenceElement) {
         std::string constructionName = escapeName(constructionReferenceElement.text().as_string());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if (construction) {
           subSurface.setConstruction(*construction);
         } else {
@@ -1591,7 +1591,7 @@ namespace sdd {
       pugi::xml_node constructionReferenceElement = element.child("DrConsRef");
       if (constructionReferenceElement) {
         std::string constructionName = escapeName(constructionReferenceElement.text().as_string());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if (construction) {
           subSurface.setConstruction(*construction);
         } else {
@@ -1609,7 +1609,7 @@ namespace sdd {
       pugi::xml_node constructionReferenceElement = element.child("FenConsRef");
       if (constructionReferenceElement) {
         std::string constructionName = escapeName(constructionReferenceElement.text().as_string());
-        boost::optional<model::ConstructionBase> construction = surface.model().getModelObjectByName<model::ConstructionBase>(constructionName);
+        boost::optional<model::ConstructionBase> construction = getModelObjectByName<model::ConstructionBase>(surface.model(), constructionName);
         if (construction) {
           subSurface.setConstruction(*construction);
         } else {
@@ -1736,7 +1736,7 @@ namespace sdd {
           pugi::xml_node scheduleReferenceElement = element.child("TransSchRef");
           if (scheduleReferenceElement) {
             scheduleName = escapeName(scheduleReferenceElement.text().as_string());
-            schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+            schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
             if (!schedule) {
               LOG(Error, "Cannot find shading schedule '" << scheduleName << "' for shading surface '" << name << "'");
             }
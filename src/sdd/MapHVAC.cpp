@@ -485,7 +485,7 @@ namespace sdd {
     {
       pugi::xml_node element = vrfSysElement.child("AvailSchRef");
       std::string name = escapeName(element.text().as_string());
-      if (auto schedule = model.getModelObjectByName<model::Schedule>(name)) {
+      if (auto schedule = getModelObjectByName<model::Schedule>(model, name)) {
         vrf.setAvailabilitySchedule(schedule.get());
       }
     }
@@ -530,7 +530,7 @@ namespace sdd {
 
     {
       auto element = vrfSysElement.child("CtrlSchRef");
-      if (auto schedule = model.getModelObjectByName<model::Schedule>(element.text().as_string())) {
+      if (auto schedule = getModelObjectByName<model::Schedule>(model, element.text().as_string())) {
         vrf.setThermostatPrioritySchedule(schedule.get());
       }
     }
@@ -783,7 +783,7 @@ namespace sdd {
                         const std::function<bool(model::AirConditionerVariableRefrigerantFlow&, const model::Curve&)>& osSetter,
                         const std::function<boost::optional<model::Curve>(model::AirConditionerVariableRefrigerantFlow&)>& osGetter) {
       std::string value = vrfSysElement.child(elementName.c_str()).text().as_string();
-      auto newcurve = model.getModelObjectByName<model::Curve>(value);
+      auto newcurve = getModelObjectByName<model::Curve>(model, value);
       if (newcurve) {
         if (auto oldcurve = osGetter(vrf)) {
           if (oldcurve.get() != newcurve.get()) {
@@ -946,7 +946,7 @@ namespace sdd {
     // Availability Schedule
     boost::optional<model::Schedule> availabilitySchedule;
     if (airHndlrAvailSchElement) {
-      availabilitySchedule = model.getModelObjectByName<model::Schedule>(airHndlrAvailSchElement.text().as_string());
+      availabilitySchedule = getModelObjectByName<model::Schedule>(model, airHndlrAvailSchElement.text().as_string());
     }
 
     if (availabilitySchedule) {
@@ -1345,13 +1345,13 @@ namespace sdd {
 
         // MinOAFracSchRef
         pugi::xml_node minOAFracSchRefElement = airSystemOACtrlElement.child("MinOAFracSchRef");
-        if (boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(minOAFracSchRefElement.text().as_string())) {
+        if (boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, minOAFracSchRefElement.text().as_string())) {
           oaController.setMinimumFractionofOutdoorAirSchedule(schedule.get());
         }
 
         // MaxOAFracSchRef
         pugi::xml_node maxOAFracSchRefElement = airSystemOACtrlElement.child("MaxOAFracSchRef");
-        if (boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(maxOAFracSchRefElement.text().as_string())) {
+        if (boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, maxOAFracSchRefElement.text().as_string())) {
           oaController.setMaximumFractionofOutdoorAirSchedule(schedule.get());
         } else {
           // MaxOARat
@@ -1384,7 +1384,7 @@ namespace sdd {
 
         // EconoAvailSchRef
         auto econoAvailSchRef = airSystemOACtrlElement.child("EconoAvailSchRef").text().as_string();
-        if (auto schedule = model.getModelObjectByName<model::Schedule>(econoAvailSchRef)) {
+        if (auto schedule = getModelObjectByName<model::Schedule>(model, econoAvailSchRef)) {
           oaController.setTimeofDayEconomizerControlSchedule(schedule.get());
         }
 
@@ -1425,7 +1425,7 @@ namespace sdd {
           pugi::xml_node oaSchRefElement = airSystemOACtrlElement.child("OASchRef");
 
           boost::optional<model::Schedule> schedule;
-          schedule = model.getModelObjectByName<model::Schedule>(oaSchRefElement.text().as_string());
+          schedule = getModelObjectByName<model::Schedule>(model, oaSchRefElement.text().as_string());
 
           if (schedule) {
             oaController.setMinimumOutdoorAirSchedule(schedule.get());
@@ -1562,7 +1562,7 @@ namespace sdd {
           } else if (istringEqual(tempCtrl, "Scheduled")) {
             hx.setSupplyAirOutletTemperatureControl(true);
             auto schRef = htRcvryElement.child("TempSetptSchRef").text().as_string();
-            auto sch = model.getModelObjectByName<model::Schedule>(schRef);
+            auto sch = getModelObjectByName<model::Schedule>(model, schRef);
             if (sch) {
               model::SetpointManagerScheduled spm(model, sch.get());
               spm.setName(hx.nameString() + " Setpoint");
@@ -1821,7 +1821,7 @@ namespace sdd {
     } else if (istringEqual(clgCtrlElement.text().as_string(), "Scheduled")) {
       pugi::xml_node clgSetPtSchRefElement = airSystemElement.child("ClgSetptSchRef");
 
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(clgSetPtSchRefElement.text().as_string());
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, clgSetPtSchRefElement.text().as_string());
 
       if (!schedule) {
         model::ScheduleRuleset schedule(model);
@@ -1935,7 +1935,7 @@ namespace sdd {
 
       pugi::xml_node clgSetptSchRefElement = airSystemElement.child("ClgSetptSchRef");
       std::string clgSetptSchRef = escapeName(clgSetptSchRefElement.text().as_string());
-      coolingSchedule = model.getModelObjectByName<model::Schedule>(clgSetptSchRef);
+      coolingSchedule = getModelObjectByName<model::Schedule>(model, clgSetptSchRef);
 
       if (!coolingSchedule) {
         LOG(Warn, nameElement.text().as_string() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -1949,7 +1949,7 @@ namespace sdd {
 
       pugi::xml_node htgSetptSchRefElement = airSystemElement.child("HtgSetptSchRef");
       std::string htgSetptSchRef = escapeName(htgSetptSchRefElement.text().as_string());
-      heatingSchedule = model.getModelObjectByName<model::Schedule>(htgSetptSchRef);
+      heatingSchedule = getModelObjectByName<model::Schedule>(model, htgSetptSchRef);
 
       if (!heatingSchedule) {
         LOG(Warn, nameElement.text().as_string() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -2042,7 +2042,7 @@ namespace sdd {
       // FurnHIR_fPLRCrvRef
       boost::optional<model::Curve> hirCurve;
       pugi::xml_node hirCurveElement = heatingCoilElement.child("FurnHIR_fPLRCrvRef");
-      hirCurve = model.getModelObjectByName<model::Curve>(hirCurveElement.text().as_string());
+      hirCurve = getModelObjectByName<model::Curve>(model, hirCurveElement.text().as_string());
       if (hirCurve) {
         coil.setPartLoadFractionCorrelationCurve(hirCurve.get());
       }
@@ -2255,7 +2255,7 @@ namespace sdd {
         boost::optional<model::Curve> totalHeatingCapacityFunctionofTemperatureCurve;
         pugi::xml_node totalHeatingCapacityFunctionofTemperatureCurveElement = heatingCoilElement.child("HtPumpCap_fTempCrvRef");
         totalHeatingCapacityFunctionofTemperatureCurve =
-          model.getModelObjectByName<model::Curve>(totalHeatingCapacityFunctionofTemperatureCurveElement.text().as_string());
+          getModelObjectByName<model::Curve>(model, totalHeatingCapacityFunctionofTemperatureCurveElement.text().as_string());
 
         if (!totalHeatingCapacityFunctionofTemperatureCurve) {
           model::CurveCubic _totalHeatingCapacityFunctionofTemperatureCurve(model);
@@ -2273,7 +2273,7 @@ namespace sdd {
         boost::optional<model::Curve> totalHeatingCapacityFunctionofFlowFractionCurve;
         pugi::xml_node totalHeatingCapacityFunctionofFlowFractionCurveElement = heatingCoilElement.child("HtPumpCap_fFlowCrvRef");
         totalHeatingCapacityFunctionofFlowFractionCurve =
-          model.getModelObjectByName<model::Curve>(totalHeatingCapacityFunctionofFlowFractionCurveElement.text().as_string());
+          getModelObjectByName<model::Curve>(model, totalHeatingCapacityFunctionofFlowFractionCurveElement.text().as_string());
 
         if (!totalHeatingCapacityFunctionofFlowFractionCurve) {
           model::CurveCubic _totalHeatingCapacityFunctionofFlowFractionCurve(model);
@@ -2291,7 +2291,7 @@ namespace sdd {
         boost::optional<model::Curve> energyInputRatioFunctionofTemperatureCurve;
         pugi::xml_node energyInputRatioFunctionofTemperatureCurveElement = heatingCoilElement.child("HtPumpEIR_fTempCrvRef");
         energyInputRatioFunctionofTemperatureCurve =
-          model.getModelObjectByName<model::Curve>(energyInputRatioFunctionofTemperatureCurveElement.text().as_string());
+          getModelObjectByName<model::Curve>(model, energyInputRatioFunctionofTemperatureCurveElement.text().as_string());
 
         if (!energyInputRatioFunctionofTemperatureCurve) {
           model::CurveCubic _energyInputRatioFunctionofTemperatureCurve(model);
@@ -2309,7 +2309,7 @@ namespace sdd {
         boost::optional<model::Curve> energyInputRatioFunctionofFlowFractionCurve;
         pugi::xml_node energyInputRatioFunctionofFlowFractionCurveElement = heatingCoilElement.child("HtPumpEIR_fFlowCrvRef");
         energyInputRatioFunctionofFlowFractionCurve =
-          model.getModelObjectByName<model::Curve>(energyInputRatioFunctionofFlowFractionCurveElement.text().as_string());
+          getModelObjectByName<model::Curve>(model, energyInputRatioFunctionofFlowFractionCurveElement.text().as_string());
 
         if (!energyInputRatioFunctionofFlowFractionCurve) {
           model::CurveQuadratic _energyInputRatioFunctionofFlowFractionCurve(model);
@@ -2325,7 +2325,7 @@ namespace sdd {
         // HtPumpEIR_fPLFCrvRef
         boost::optional<model::Curve> partLoadFractionCorrelationCurve;
         pugi::xml_node partLoadFractionCorrelationCurveElement = heatingCoilElement.child("HtPumpEIR_fPLFCrvRef");
-        partLoadFractionCorrelationCurve = model.getModelObjectByName<model::Curve>(partLoadFractionCorrelationCurveElement.text().as_string());
+        partLoadFractionCorrelationCurve = getModelObjectByName<model::Curve>(model, partLoadFractionCorrelationCurveElement.text().as_string());
 
         if (!partLoadFractionCorrelationCurve) {
           model::CurveQuadratic _partLoadFractionCorrelationCurve(model);
@@ -2463,7 +2463,7 @@ namespace sdd {
     //AvailSchRef
     pugi::xml_node availSchRefElement = fanElement.child("AvailSchRef");
     std::string availSchRef = escapeName(availSchRefElement.text().as_string());
-    auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+    auto availSch = getModelObjectByName<model::Schedule>(model, availSchRef);
 
     // FanControlMethod
     pugi::xml_node fanControlMethodElement = fanElement.child("CtrlMthdSim");
@@ -2566,7 +2566,7 @@ namespace sdd {
           // Pwr_fPLRCrvRef
           pugi::xml_node pwr_fPLRCrvElement = fanElement.child("Pwr_fPLRCrvRef");
           boost::optional<model::Curve> pwr_fPLRCrv;
-          pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().as_string());
+          pwr_fPLRCrv = getModelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().as_string());
           if (pwr_fPLRCrv) {
             fan.setFanPowerRatioFunctionofSpeedRatioCurve(pwr_fPLRCrv.get());
           }
@@ -2662,7 +2662,7 @@ namespace sdd {
       // Pwr_fPLRCrvRef
       pugi::xml_node pwr_fPLRCrvElement = fanElement.child("Pwr_fPLRCrvRef");
       boost::optional<model::Curve> pwr_fPLRCrv;
-      pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().as_string());
+      pwr_fPLRCrv = getModelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().as_string());
       if (pwr_fPLRCrv) {
         if (boost::optional<model::CurveCubic> curveCubic = pwr_fPLRCrv->optionalCast<model::CurveCubic>()) {
           fan.setFanPowerCoefficient1(curveCubic->coefficient1Constant());
@@ -2709,7 +2709,7 @@ namespace sdd {
     // AvailSchRef
     auto availSchRefElement = element.child("AvailSchRef");
     auto availSchRef = escapeName(availSchRefElement.text().as_string());
-    auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+    auto availSch = getModelObjectByName<model::Schedule>(model, availSchRef);
     if (availSch) {
       hx.setAvailabilitySchedule(availSch.get());
     }
@@ -3069,7 +3069,7 @@ namespace sdd {
 
         boost::optional<model::Curve> coolingCurveFofTemp;
         pugi::xml_node cap_fTempCrvRefElement = coolingCoilElement.child("Cap_fTempCrvRef");
-        coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().as_string());
+        coolingCurveFofTemp = getModelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().as_string());
         if (!coolingCurveFofTemp) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken Cap_fTempCrvRef");
 
@@ -3092,7 +3092,7 @@ namespace sdd {
 
         boost::optional<model::Curve> coolingCurveFofFlow;
         pugi::xml_node cap_fFlowCrvRefElement = coolingCoilElement.child("Cap_fFlowCrvRef");
-        coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().as_string());
+        coolingCurveFofFlow = getModelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().as_string());
         if (!coolingCurveFofFlow) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken Cap_fFlowCrvRef");
 
@@ -3110,7 +3110,7 @@ namespace sdd {
 
         boost::optional<model::Curve> energyInputRatioFofTemp;
         pugi::xml_node dxEIR_fTempCrvRefElement = coolingCoilElement.child("DXEIR_fTempCrvRef");
-        energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().as_string());
+        energyInputRatioFofTemp = getModelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().as_string());
         if (!energyInputRatioFofTemp) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken DXEIR_fTempCrvRef");
 
@@ -3133,7 +3133,7 @@ namespace sdd {
 
         boost::optional<model::Curve> energyInputRatioFofFlow;
         pugi::xml_node dxEIR_fFlowCrvRefElement = coolingCoilElement.child("DXEIR_fFlowCrvRef");
-        energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().as_string());
+        energyInputRatioFofFlow = getModelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().as_string());
         if (!energyInputRatioFofFlow) {
           model::CurveQuadratic _energyInputRatioFofFlow(model);
           _energyInputRatioFofFlow.setCoefficient1Constant(1.20550);
@@ -3148,7 +3148,7 @@ namespace sdd {
 
         boost::optional<model::Curve> partLoadFraction;
         pugi::xml_node dxEIR_fPLFCrvRefElement = coolingCoilElement.child("DXEIR_fPLFCrvRef");
-        partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().as_string());
+        partLoadFraction = getModelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().as_string());
         if (!partLoadFraction) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken DXEIR_fPLFCrvRef");
 
@@ -3239,7 +3239,7 @@ namespace sdd {
 
         boost::optional<model::Curve> coolingCurveFofTemp;
         pugi::xml_node cap_fTempCrvRefElement = coolingCoilElement.child("Cap_fTempCrvRef");
-        coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().as_string());
+        coolingCurveFofTemp = getModelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().as_string());
         if (!coolingCurveFofTemp) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken Cap_fTempCrvRef");
 
@@ -3262,7 +3262,7 @@ namespace sdd {
 
         boost::optional<model::Curve> coolingCurveFofFlow;
         pugi::xml_node cap_fFlowCrvRefElement = coolingCoilElement.child("Cap_fFlowCrvRef");
-        coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().as_string());
+        coolingCurveFofFlow = getModelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().as_string());
         if (!coolingCurveFofFlow) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken Cap_fFlowCrvRef");
 
@@ -3280,7 +3280,7 @@ namespace sdd {
 
         boost::optional<model::Curve> energyInputRatioFofTemp;
         pugi::xml_node dxEIR_fTempCrvRefElement = coolingCoilElement.child("DXEIR_fTempCrvRef");
-        energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().as_string());
+        energyInputRatioFofTemp = getModelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().as_string());
         if (!energyInputRatioFofTemp) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken DXEIR_fTempCrvRef");
 
@@ -3303,7 +3303,7 @@ namespace sdd {
 
         boost::optional<model::Curve> energyInputRatioFofFlow;
         pugi::xml_node dxEIR_fFlowCrvRefElement = coolingCoilElement.child("DXEIR_fFlowCrvRef");
-        energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().as_string());
+        energyInputRatioFofFlow = getModelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().as_string());
         if (!energyInputRatioFofFlow) {
           model::CurveQuadratic _energyInputRatioFofFlow(model);
           _energyInputRatioFofFlow.setCoefficient1Constant(1.20550);
@@ -3318,7 +3318,7 @@ namespace sdd {
 
         boost::optional<model::Curve> partLoadFraction;
         pugi::xml_node dxEIR_fPLFCrvRefElement = coolingCoilElement.child("DXEIR_fPLFCrvRef");
-        partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().as_string());
+        partLoadFraction = getModelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().as_string());
         if (!partLoadFraction) {
           LOG(Error, "Coil: " << nameElement.text().as_string() << "Broken DXEIR_fPLFCrvRef");
 
@@ -3511,7 +3511,7 @@ namespace sdd {
     // Name
     pugi::xml_node nameElement = thermalZoneElement.child("Name");
     std::string name = nameElement.text().as_string();
-    optionalThermalZone = model.getModelObjectByName<model::ThermalZone>(name);
+    optionalThermalZone = getModelObjectByName<model::ThermalZone>(model, name);
 
     if (!optionalThermalZone) {
       return result;
@@ -3694,7 +3694,7 @@ namespace sdd {
 
       pugi::xml_node exhAvailSchRefElement = thermalZoneElement.child("ExhAvailSchRef");
       std::string exhAvailSchRef = escapeName(exhAvailSchRefElement.text().as_string());
-      boost::optional<model::Schedule> exhAvailSch = model.getModelObjectByName<model::Schedule>(exhAvailSchRef);
+      boost::optional<model::Schedule> exhAvailSch = getModelObjectByName<model::Schedule>(model, exhAvailSchRef);
       if (exhAvailSch) {
         exhaustFan.setAvailabilitySchedule(exhAvailSch.get());
       }
@@ -3714,7 +3714,7 @@ namespace sdd {
 
       pugi::xml_node exhFlowSchRefElement = thermalZoneElement.child("ExhFlowSchRef");
       std::string exhFlowSchRef = escapeName(exhFlowSchRefElement.text().as_string());
-      boost::optional<model::Schedule> exhFlowSch = model.getModelObjectByName<model::Schedule>(exhFlowSchRef);
+      boost::optional<model::Schedule> exhFlowSch = getModelObjectByName<model::Schedule>(model, exhFlowSchRef);
       if (exhFlowSch) {
         exhaustFan.setFlowFractionSchedule(exhFlowSch.get());
       }
@@ -3728,14 +3728,14 @@ namespace sdd {
 
       pugi::xml_node exhMinTempSchRefElement = thermalZoneElement.child("ExhMinTempSchRef");
       std::string exhMinTempSchRef = escapeName(exhMinTempSchRefElement.text().as_string());
-      boost::optional<model::Schedule> exhMinTempSch = model.getModelObjectByName<model::Schedule>(exhMinTempSchRef);
+      boost::optional<model::Schedule> exhMinTempSch = getModelObjectByName<model::Schedule>(model, exhMinTempSchRef);
       if (exhMinTempSch) {
         exhaustFan.setMinimumZoneTemperatureLimitSchedule(exhMinTempSch.get());
       }
 
       pugi::xml_node exhBalancedSchRefElement = thermalZoneElement.child("ExhBalancedSchRef");
       std::string exhBalancedSchRef = escapeName(exhBalancedSchRefElement.text().as_string());
-      boost::optional<model::Schedule> exhBalancedSch = model.getModelObjectByName<model::Schedule>(exhBalancedSchRef);
+      boost::optional<model::Schedule> exhBalancedSch = getModelObjectByName<model::Schedule>(model, exhBalancedSchRef);
       if (exhBalancedSch) {
         exhaustFan.setBalancedExhaustFractionSchedule(exhBalancedSch.get());
       }
@@ -4005,7 +4005,7 @@ namespace sdd {
     }
 
     if (translateVentSys) {
-      airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(ventSysRefElement.text().as_string());
+      airLoopHVAC = getModelObjectByName<model::AirLoopHVAC>(model, ventSysRefElement.text().as_string());
 
       if (airLoopHVAC && !thermalZone.airLoopHVAC()) {
         pugi::xml_node trmlUnitElement = findTrmlUnitElementForZone(nameElement);
@@ -4014,7 +4014,7 @@ namespace sdd {
             ventSysEquip = trmlUnit;
             airLoopHVAC->addBranchForZone(thermalZone, trmlUnit->cast<model::StraightComponent>());
             pugi::xml_node inducedAirZnRefElement = trmlUnitElement.child("InducedAirZnRef");
-            if (boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().as_string())) {
+            if (boost::optional<model::ThermalZone> tz = getModelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().as_string())) {
               if (tz->isPlenum()) {
                 if (boost::optional<model::AirTerminalSingleDuctSeriesPIUReheat> piu =
                       trmlUnit->optionalCast<model::AirTerminalSingleDuctSeriesPIUReheat>()) {
@@ -4080,7 +4080,7 @@ namespace sdd {
           }
         }
       } else {
-        airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(sysInfo.SysRefElement.text().as_string());
+        airLoopHVAC = getModelObjectByName<model::AirLoopHVAC>(model, sysInfo.SysRefElement.text().as_string());
 
         if (airLoopHVAC && !thermalZone.airLoopHVAC()) {
           pugi::xml_node trmlUnitElement = findTrmlUnitElementForZone(nameElement);
@@ -4090,7 +4090,7 @@ namespace sdd {
               airLoopHVAC->addBranchForZone(thermalZone, trmlUnit->cast<model::StraightComponent>());
               pugi::xml_node inducedAirZnRefElement = trmlUnitElement.child("InducedAirZnRef");
               if (boost::optional<model::ThermalZone> tz =
-                    model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().as_string())) {
+                    getModelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().as_string())) {
                 if (tz->isPlenum()) {
                   if (boost::optional<model::AirTerminalSingleDuctSeriesPIUReheat> piu =
                         trmlUnit->optionalCast<model::AirTerminalSingleDuctSeriesPIUReheat>()) {
@@ -4229,7 +4229,7 @@ namespace sdd {
     pugi::xml_node clgTstatSchRefElement = thermalZoneElement.child("ClgTstatSchRef");
     if (clgTstatSchRefElement) {
       std::string scheduleName = escapeName(clgTstatSchRefElement.text().as_string());
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
       if (schedule) {
         if (optionalThermostat) {
           optionalThermostat->setCoolingSchedule(*schedule);
@@ -4257,7 +4257,7 @@ namespace sdd {
     pugi::xml_node htgTstatSchRefElement = thermalZoneElement.child("HtgTstatSchRef");
     if (htgTstatSchRefElement) {
       std::string scheduleName = escapeName(htgTstatSchRefElement.text().as_string());
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
       if (schedule) {
         if (optionalThermostat) {
           optionalThermostat->setHeatingSchedule(*schedule);
@@ -4287,14 +4287,14 @@ namespace sdd {
     if (airLoopHVAC) {
       pugi::xml_node rtnPlenumZnRefElement = thermalZoneElement.child("RetPlenumZnRef");
       boost::optional<model::ThermalZone> returnPlenumZone;
-      returnPlenumZone = model.getModelObjectByName<model::ThermalZone>(rtnPlenumZnRefElement.text().as_string());
+      returnPlenumZone = getModelObjectByName<model::ThermalZone>(model, rtnPlenumZnRefElement.text().as_string());
       if (returnPlenumZone) {
         thermalZone.setReturnPlenum(returnPlenumZone.get());
       }
 
       pugi::xml_node supPlenumZnRefElement = thermalZoneElement.child("SupPlenumZnRef");
       boost::optional<model::ThermalZone> supplyPlenumZone;
-      supplyPlenumZone = model.getModelObjectByName<model::ThermalZone>(supPlenumZnRefElement.text().as_string());
+      supplyPlenumZone = getModelObjectByName<model::ThermalZone>(model, supPlenumZnRefElement.text().as_string());
       if (supplyPlenumZone) {
         thermalZone.setSupplyPlenum(supplyPlenumZone.get());
       }
@@ -4360,14 +4360,14 @@ namespace sdd {
       for (const auto& info : priAirCondInfo) {
         if (info.ZnSysElement) {
           auto availSchRefElement = info.ZnSysElement.child("AvailSchRef");
-          if (auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string())) {
+          if (auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().as_string())) {
             zoneVent.setSchedule(availSch.get());
             break;
           }
         } else if (info.AirSysElement) {
           auto availSchRefElement = info.AirSysElement.child("AvailSchRef");
-          auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string());
-          if (auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string())) {
+          auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().as_string());
+          if (auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().as_string())) {
             zoneVent.setSchedule(availSch.get());
             break;
           }
@@ -4393,7 +4393,7 @@ namespace sdd {
 
     // AvailSchRef
     pugi::xml_node availSchRefElement = trmlUnitElement.child("AvailSchRef");
-    boost::optional<model::Schedule> availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().as_string());
+    boost::optional<model::Schedule> availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().as_string());
 
     // Type
     pugi::xml_node typeElement = trmlUnitElement.child("TypeSim");
@@ -4428,7 +4428,7 @@ namespace sdd {
       model::AirTerminalSingleDuctVAVNoReheat terminal(model, schedule);
 
       pugi::xml_node minAirFracSchRefElement = trmlUnitElement.child("MinAirFracSchRef");
-      if (boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().as_string())) {
+      if (boost::optional<model::Schedule> minAirFracSch = getModelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().as_string())) {
         terminal.setZoneMinimumAirFlowInputMethod("Scheduled");
         terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
       } else if (primaryAirFlowMin) {
@@ -4475,7 +4475,7 @@ namespace sdd {
       model::AirTerminalSingleDuctVAVReheat terminal(model, schedule, coil.get());
 
       pugi::xml_node minAirFracSchRefElement = trmlUnitElement.child("MinAirFracSchRef");
-      if (boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().as_string())) {
+      if (boost::optional<model::Schedule> minAirFracSch = getModelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().as_string())) {
         terminal.setZoneMinimumAirFlowInputMethod("Scheduled");
         terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
       } else if (primaryAirFlowMin) {
@@ -4728,7 +4728,7 @@ namespace sdd {
     pugi::xml_node nameElement = fluidSysElement.child("Name");
     std::string plantName = nameElement.text().as_string();
 
-    if (boost::optional<model::PlantLoop> plant = model.getModelObjectByName<model::PlantLoop>(plantName)) {
+    if (boost::optional<model::PlantLoop> plant = getModelObjectByName<model::PlantLoop>(model, plantName)) {
       return plant.get();
     }
 
@@ -4835,21 +4835,21 @@ namespace sdd {
 
       {
         auto schRef = thrmlEngyStorElement.child("ChlrOnlySchRef").text().as_string();
-        if (auto sch = model.getModelObjectByName<model::Schedule>(schRef)) {
+        if (auto sch = getModelObjectByName<model::Schedule>(model, schRef)) {
           plantLoop.setPlantEquipmentOperationCoolingLoadSchedule(sch.get());
         }
       }
 
       {
         auto schRef = thrmlEngyStorElement.child("DischrgSchRef").text().as_string();
-        if (auto sch = model.getModelObjectByName<model::Schedule>(schRef)) {
+        if (auto sch = getModelObjectByName<model::Schedule>(model, schRef)) {
           plantLoop.setPrimaryPlantEquipmentOperationSchemeSchedule(sch.get());
         }
       }
 
       {
         auto schRef = thrmlEngyStorElement.child("ChrgSchRef").text().as_string();
-        if (auto sch = model.getModelObjectByName<model::Schedule>(schRef)) {
+        if (auto sch = getModelObjectByName<model::Schedule>(model, schRef)) {
           plantLoop.setComponentSetpointOperationSchemeSchedule(sch.get());
         }
       }
@@ -5275,7 +5275,7 @@ namespace sdd {
     } else if (istringEqual(tempCtrlElement.text().as_string(), "Scheduled")) {
       pugi::xml_node tempSetPtSchRefElement = fluidSysElement.child("TempSetptSchRef");
 
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(tempSetPtSchRefElement.text().as_string());
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, tempSetPtSchRefElement.text().as_string());
 
       if (!schedule) {
         LOG(Error, plantLoop.name().get() << " Control type is scheduled, but a valid schedule could not be found.");
@@ -5647,7 +5647,7 @@ namespace sdd {
 
       boost::optional<model::CurveCubic> pwr_fPLRCrv;
       pugi::xml_node pwr_fPLRCrvRefElement = pumpElement.child("Pwr_fPLRCrvRef");
-      pwr_fPLRCrv = model.getModelObjectByName<model::CurveCubic>(pwr_fPLRCrvRefElement.text().as_string());
+      pwr_fPLRCrv = getModelObjectByName<model::CurveCubic>(model, pwr_fPLRCrvRefElement.text().as_string());
 
       if (pwr_fPLRCrv) {
         double c1 = pwr_fPLRCrv->coefficient1Constant();
@@ -5705,7 +5705,7 @@ namespace sdd {
 
     boost::optional<model::Curve> hirfPLRCrv;
     pugi::xml_node hirfPLRCrvRefElement = boilerElement.child("HIR_fPLRCrvRef");
-    hirfPLRCrv = model.getModelObjectByName<model::Curve>(hirfPLRCrvRefElement.text().as_string());
+    hirfPLRCrv = getModelObjectByName<model::Curve>(model, hirfPLRCrvRefElement.text().as_string());
     if (hirfPLRCrv) {
       boiler.setNormalizedBoilerEfficiencyCurve(hirfPLRCrv.get());
 
@@ -5864,7 +5864,7 @@ namespace sdd {
 
       boost::optional<model::CurveCubic> vsdFanPwrRatio_fQRatio;
       pugi::xml_node vsdFanPwrRatio_fQRatioElement = htRejElement.child("VSDFanPwrRatio_fQRatio");
-      vsdFanPwrRatio_fQRatio = model.getModelObjectByName<model::CurveCubic>(vsdFanPwrRatio_fQRatioElement.text().as_string());
+      vsdFanPwrRatio_fQRatio = getModelObjectByName<model::CurveCubic>(model, vsdFanPwrRatio_fQRatioElement.text().as_string());
 
       if (vsdFanPwrRatio_fQRatio) {
         tower.setFanPowerRatioFunctionofAirFlowRateRatioCurve(vsdFanPwrRatio_fQRatio.get());
@@ -6078,7 +6078,7 @@ namespace sdd {
     if (istringEqual("Zone", storLctnSim)) {
       tes.setAmbientTemperatureIndicator("Zone");
       std::string storZnRef = tesElement.child("StorZnRef").text().as_string();
-      if (auto tz = model.getModelObjectByName<model::ThermalZone>(storZnRef)) {
+      if (auto tz = getModelObjectByName<model::ThermalZone>(model, storZnRef)) {
         tes.setAmbientTemperatureThermalZone(tz.get());
       }
     } else {
@@ -6100,7 +6100,7 @@ namespace sdd {
     tes.setUseSideHeatTransferEffectiveness(1.0);
 
     std::string dischrgSchRef = tesElement.child("DischrgSchRef").text().as_string();
-    if (auto schedule = model.getModelObjectByName<model::Schedule>(dischrgSchRef)) {
+    if (auto schedule = getModelObjectByName<model::Schedule>(model, dischrgSchRef)) {
       tes.setUseSideAvailabilitySchedule(schedule.get());
     }
 
@@ -6124,7 +6124,7 @@ namespace sdd {
     tes.setSourceSideHeatTransferEffectiveness(1.0);
 
     std::string chrgSchRef = tesElement.child("ChrgSchRef").text().as_string();
-    if (auto schedule = model.getModelObjectByName<model::Schedule>(chrgSchRef)) {
+    if (auto schedule = getModelObjectByName<model::Schedule>(model, chrgSchRef)) {
       tes.setSourceSideAvailabilitySchedule(schedule.get());
     }
 
@@ -6241,7 +6241,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("HIR_fPLRCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.generatorHeatInputFunctionofPartLoadRatioCurve();
           if (chiller.setGeneratorHeatInputFunctionofPartLoadRatioCurve(curve.get())) {
             oldCurve.remove();
@@ -6251,7 +6251,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("HIR_fCndTempCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofCondenserTemperatureCurve();
           if (chiller.setGeneratorHeatInputCorrectionFunctionofCondenserTemperatureCurve(curve.get())) {
             oldCurve.remove();
@@ -6261,7 +6261,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("HIR_fEvapTempCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve();
           if (chiller.setGeneratorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve(curve.get())) {
             oldCurve.remove();
@@ -6271,7 +6271,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("Cap_fCndTempCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.capacityCorrectionFunctionofCondenserTemperatureCurve();
           if (chiller.setCapacityCorrectionFunctionofCondenserTemperatureCurve(curve.get())) {
             oldCurve.remove();
@@ -6281,7 +6281,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("Cap_fEvapTempCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.capacityCorrectionFunctionofChilledWaterTemperatureCurve();
           if (chiller.setCapacityCorrectionFunctionofChilledWaterTemperatureCurve(curve.get())) {
             oldCurve.remove();
@@ -6291,7 +6291,7 @@ namespace sdd {
 
       {
         auto curveElement = chillerElement.child("Cap_fGenTempCrvRef");
-        if (auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().as_string())) {
+        if (auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().as_string())) {
           auto oldCurve = chiller.capacityCorrectionFunctionofGeneratorTemperatureCurve();
           if (chiller.setCapacityCorrectionFunctionofGeneratorTemperatureCurve(curve.get())) {
             oldCurve.remove();
@@ -6302,7 +6302,7 @@ namespace sdd {
       // Cap_fTempCrvRef
       boost::optional<model::CurveBiquadratic> cap_fTempCrv;
       pugi::xml_node cap_fTempCrvElement = chillerElement.child("Cap_fTempCrvRef");
-      cap_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(cap_fTempCrvElement.text().as_string());
+      cap_fTempCrv = getModelObjectByName<model::CurveBiquadratic>(model, cap_fTempCrvElement.text().as_string());
       if (!cap_fTempCrv) {
         LOG(Error, "Coil: " << name << " Broken Cap_fTempCrv");
 
@@ -6322,7 +6322,7 @@ namespace sdd {
       // EIR_fTempCrvRef
       boost::optional<model::CurveBiquadratic> eir_fTempCrv;
       pugi::xml_node eir_fTempCrvElement = chillerElement.child("EIR_fTempCrvRef");
-      eir_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(eir_fTempCrvElement.text().as_string());
+      eir_fTempCrv = getModelObjectByName<model::CurveBiquadratic>(model, eir_fTempCrvElement.text().as_string());
       if (!eir_fTempCrv) {
         LOG(Error, "Coil: " << name << "Broken EIR_fTempCrvRef");
 
@@ -6342,7 +6342,7 @@ namespace sdd {
       // EIR_fPLRCrvRef
       boost::optional<model::CurveQuadratic> eir_fPLRCrv;
       pugi::xml_node eir_fPLRCrvElement = chillerElement.child("EIR_fPLRCrvRef");
-      eir_fPLRCrv = model.getModelObjectByName<model::CurveQuadratic>(eir_fPLRCrvElement.text().as_string());
+      eir_fPLRCrv = getModelObjectByName<model::CurveQuadratic>(model, eir_fPLRCrvElement.text().as_string());
       if (!eir_fPLRCrv) {
         LOG(Error, "Coil: " << name << "Broken EIR_fPLRCrvRef");
 
@@ -6483,7 +6483,7 @@ namespace sdd {
 
       // Might have to relocate after zones are available
       std::string cprsrZnRef = element.child("CprsrZnRef").text().as_string();
-      if (auto zone = model.getModelObjectByName<model::ThermalZone>(cprsrZnRef)) {
+      if (auto zone = getModelObjectByName<model::ThermalZone>(model, cprsrZnRef)) {
         heatPump.addToThermalZone(zone.get());
       }
 
@@ -6527,7 +6527,7 @@ namespace sdd {
       }
 
       std::string storZnRef = element.child("StorZnRef").text().as_string();
-      if (auto zone = model.getModelObjectByName<model::ThermalZone>(storZnRef)) {
+      if (auto zone = getModelObjectByName<model::ThermalZone>(model, storZnRef)) {
         waterHeater.setAmbientTemperatureThermalZone(zone.get());
       }
 
@@ -6563,7 +6563,7 @@ namespace sdd {
 
       {
         auto curveRef = element.child("HIR_fPLRCrvRef").text().as_string();
-        auto newcurve = model.getModelObjectByName<model::Curve>(curveRef);
+        auto newcurve = getModelObjectByName<model::Curve>(model, curveRef);
         if (newcurve) {
           auto oldcurve = waterHeater.partLoadFactorCurve();
           if (oldcurve && (oldcurve.get() != newcurve.get())) {
@@ -6653,7 +6653,7 @@ namespace sdd {
                           const std::function<bool(model::CoilWaterHeatingAirToWaterHeatPump&, const model::Curve&)>& osSetter,
                           const std::function<model::Curve(model::CoilWaterHeatingAirToWaterHeatPump&)>& osGetter) {
         auto value = element.child(elementName.c_str()).text().as_string();
-        auto newcurve = model.getModelObjectByName<model::Curve>(value);
+        auto newcurve = getModelObjectByName<model::Curve>(model, value);
         if (newcurve) {
           auto oldcurve = osGetter(coil);
           if (oldcurve != newcurve.get()) {
@@ -6823,7 +6823,7 @@ namespace sdd {
       // HIR_fPLRCrvRef
 
       pugi::xml_node hirfPLRCrvRefElement = element.child("HIR_fPLRCrvRef");
-      boost::optional<model::CurveCubic> hirfPLRCrv = model.getModelObjectByName<model::CurveCubic>(hirfPLRCrvRefElement.text().as_string());
+      boost::optional<model::CurveCubic> hirfPLRCrv = getModelObjectByName<model::CurveCubic>(model, hirfPLRCrvRefElement.text().as_string());
       if (hirfPLRCrv) {
         waterHeaterMixed.setPartLoadFactorCurve(hirfPLRCrv.get());
       }
@@ -6867,7 +6867,7 @@ namespace sdd {
     boost::optional<model::Schedule> schedule;
 
     if (scheduleElement) {
-      schedule = model.getModelObjectByName<model::Schedule>(scheduleElement.text().as_string());
+      schedule = getModelObjectByName<model::Schedule>(model, scheduleElement.text().as_string());
     }
 
     if (!schedule) {
@@ -7495,7 +7495,7 @@ namespace sdd {
 
         {
           auto value = element.child("VRFSysRef").text().as_string();
-          auto vrfSys = model.getModelObjectByName<model::AirConditionerVariableRefrigerantFlow>(value);
+          auto vrfSys = getModelObjectByName<model::AirConditionerVariableRefrigerantFlow>(model, value);
           if (vrfSys) {
             vrfSys->addTerminal(vrfTerminal);
           } else {
@@ -7643,7 +7643,7 @@ namespace sdd {
                         const std::function<bool(model::CoilHeatingDXVariableRefrigerantFlow&, const model::Curve&)>& osSetter,
                         const std::function<model::Curve(model::CoilHeatingDXVariableRefrigerantFlow&)>& osGetter) {
       auto value = element.child(elementName.c_str()).text().as_string();
-      auto newcurve = model.getModelObjectByName<model::Curve>(value);
+      auto newcurve = getModelObjectByName<model::Curve>(model, value);
       if (newcurve) {
         auto oldcurve = osGetter(coil);
         if (oldcurve != newcurve.get()) {
@@ -7697,7 +7697,7 @@ namespace sdd {
                         const std::function<bool(model::CoilCoolingDXVariableRefrigerantFlow&, const model::Curve&)>& osSetter,
                         const std::function<model::Curve(model::CoilCoolingDXVariableRefrigerantFlow&)>& osGetter) {
       auto value = element.child(elementName.c_str()).text().as_string();
-      auto newcurve = model.getModelObjectByName<model::Curve>(value);
+      auto newcurve = getModelObjectByName<model::Curve>(model, value);
       if (newcurve) {
         auto oldcurve = osGetter(coil);
         if (oldcurve != newcurve.get()) {
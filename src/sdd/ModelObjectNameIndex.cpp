@@ -0,0 +1,132 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "ModelObjectNameIndex.hpp"
+
+#include "../utilities/idf/Workspace_Impl.hpp"
+#include "../utilities/idf/WorkspaceObject_Impl.hpp"
+#include "../utilities/core/Compare.hpp"
+
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+
+namespace openstudio {
+namespace sdd {
+
+  ModelObjectNameIndex::ModelObjectNameIndex(const model::Model& model) : m_model(model), m_built(false), m_stale(false) {
+    std::shared_ptr<openstudio::detail::Workspace_Impl> impl = m_model.getImpl<openstudio::detail::Workspace_Impl>();
+    impl.get()->openstudio::detail::Workspace_Impl::addWorkspaceObject.connect<ModelObjectNameIndex, &ModelObjectNameIndex::objectAdd>(this);
+  }
+
+  std::vector<WorkspaceObject> ModelObjectNameIndex::objectsByName(const std::string& name,
+                                                                   const std::function<bool(const WorkspaceObject&)>& accept) {
+    if (!m_built) {
+      rebuild();
+    } else {
+      // names of new objects are usually set after they are added, so they are indexed here rather than in objectAdd
+      std::vector<WorkspaceObject> pending;
+      pending.swap(m_pending);
+      for (const WorkspaceObject& object : pending) {
+        indexObject(object, false);
+      }
+    }
+
+    std::vector<WorkspaceObject> result = find(name, accept);
+    if (result.empty() && m_stale) {
+      // an indexed object has been renamed since the last rebuild, it may now have this name
+      rebuild();
+      result = find(name, accept);
+    }
+    return result;
+  }
+
+  std::vector<WorkspaceObject> ModelObjectNameIndex::find(const std::string& name, const std::function<bool(const WorkspaceObject&)>& accept) {
+    std::vector<WorkspaceObject> result;
+    auto it = m_index.find(boost::algorithm::to_lower_copy(name));
+    if (it == m_index.end()) {
+      return result;
+    }
+
+    // drop entries for objects that have been removed since they were indexed
+    std::vector<WorkspaceObject>& objects = it->second;
+    objects.erase(std::remove_if(objects.begin(), objects.end(), [](const WorkspaceObject& object) { return !object.initialized(); }),
+                  objects.end());
+
+    // entries of renamed objects are kept until the next rebuild, so check the current name
+    for (const WorkspaceObject& object : objects) {
+      if (OptionalString candidate = object.name()) {
+        if (istringEqual(*candidate, name) && accept(object)) {
+          result.push_back(object);
+        }
+      }
+    }
+    return result;
+  }
+
+  void ModelObjectNameIndex::objectAdd(const WorkspaceObject& addedObject, const openstudio::IddObjectType& /*type*/,
+                                       const openstudio::UUID& /*uuid*/) {
+    m_pending.push_back(addedObject);
+  }
+
+  void ModelObjectNameIndex::nameChange() {
+    m_stale = true;
+  }
+
+  void ModelObjectNameIndex::rebuild() {
+    m_index.clear();
+    m_pending.clear();
+    m_built = true;
+    m_stale = false;
+    for (const WorkspaceObject& object : m_model.objects()) {
+      indexObject(object, true);
+    }
+  }
+
+  void ModelObjectNameIndex::indexObject(const WorkspaceObject& object, bool rebuilding) {
+    if (!object.initialized()) {
+      return;
+    }
+
+    if (m_watched.insert(object.handle()).second) {
+      std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> impl = object.getImpl<openstudio::detail::WorkspaceObject_Impl>();
+      impl.get()->openstudio::detail::IdfObject_Impl::onNameChange.connect<ModelObjectNameIndex, &ModelObjectNameIndex::nameChange>(this);
+    } else if (!rebuilding) {
+      // seen before, e.g. an object restored after a failed remove, its old entry may be gone
+      m_stale = true;
+      return;
+    }
+
+    if (OptionalString name = object.name()) {
+      m_index[boost::algorithm::to_lower_copy(*name)].push_back(object);
+    }
+  }
+
+}  // namespace sdd
+}  // namespace openstudio
@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef SDD_MODELOBJECTNAMEINDEX_HPP
+#define SDD_MODELOBJECTNAMEINDEX_HPP
+
+#include "../model/Model.hpp"
+
+#include "../utilities/idf/WorkspaceObject.hpp"
+#include "../utilities/core/UUID.hpp"
+
+#include <nano/nano_signal_slot.hpp>
+
+#include <functional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace openstudio {
+namespace sdd {
+
+  /** Index from object name to objects in a Model, used while reverse translating an SDD file.
+   *  Workspace::getObjectsByName scans every object in the workspace, which makes resolving thousands
+   *  of schedule, curve and zone references quadratic. The index is built on first use and objects added
+   *  to the model are indexed on the next lookup. Once an indexed object has been renamed, a lookup that
+   *  finds nothing rebuilds the index before giving up, so lookups return the same objects as
+   *  Workspace::getObjectsByName(name, true) filtered by accept. */
+  class ModelObjectNameIndex : public Nano::Observer
+  {
+   public:
+    explicit ModelObjectNameIndex(const model::Model& model);
+
+    const model::Model& model() const {
+      return m_model;
+    }
+
+    /// objects whose name matches exactly, ignoring case, and that are accepted by accept
+    std::vector<WorkspaceObject> objectsByName(const std::string& name, const std::function<bool(const WorkspaceObject&)>& accept);
+
+    // Note: Args 2 & 3 are simply to comply with Nano::Signal template parameters
+    void objectAdd(const WorkspaceObject& addedObject, const openstudio::IddObjectType& type, const openstudio::UUID& uuid);
+
+    void nameChange();
+
+   private:
+    void rebuild();
+    std::vector<WorkspaceObject> find(const std::string& name, const std::function<bool(const WorkspaceObject&)>& accept);
+    void indexObject(const WorkspaceObject& object, bool rebuilding);
+
+    model::Model m_model;
+    std::unordered_map<std::string, std::vector<WorkspaceObject>> m_index;
+    std::vector<WorkspaceObject> m_pending;
+    std::set<UUID> m_watched;
+    bool m_built;
+    bool m_stale;
+  };
+
+}  // namespace sdd
+}  // namespace openstudio
+
+#endif  // SDD_MODELOBJECTNAMEINDEX_HPP
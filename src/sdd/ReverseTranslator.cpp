@@ -29,6 +29,7 @@
 
 #include "ReverseTranslator.hpp"
 #include "Helpers.hpp"
+#include "ModelObjectNameIndex.hpp"
 
 #include "../model/Model.hpp"
 #include "../model/Component.hpp"
@@ -213,6 +214,21 @@ namespace sdd {
     return result;
   }
 
+  std::vector<WorkspaceObject> ReverseTranslator::objectsByName(const model::Model& model, const std::string& name,
+                                                                const std::function<bool(const WorkspaceObject&)>& accept) {
+    if (m_nameIndex && (m_nameIndex->model() == model)) {
+      return m_nameIndex->objectsByName(name, accept);
+    }
+
+    std::vector<WorkspaceObject> result;
+    for (const WorkspaceObject& object : model.getObjectsByName(name, true)) {
+      if (accept(object)) {
+        result.push_back(object);
+      }
+    }
+    return result;
+  }
+
   std::string ReverseTranslator::escapeName(std::string name) {
     std::replace(name.begin(), name.end(), ',', '-');
     std::replace(name.begin(), name.end(), ';', '-');
@@ -245,6 +261,16 @@ namespace sdd {
 
     result = openstudio::model::Model();
     result->setFastNaming(true);
+    m_nameIndex = std::make_shared<ModelObjectNameIndex>(*result);
+
+    // the index only lives for this translation, drop it however we leave, including by an exception
+    struct NameIndexReset
+    {
+      std::shared_ptr<ModelObjectNameIndex>& nameIndex;
+      ~NameIndexReset() {
+        nameIndex.reset();
+      }
+    } nameIndexReset{m_nameIndex};
 
     // do runperiod
     boost::optional<model::ModelObject> runPeriod = translateRunPeriod(projectElement, *result);
@@ -1807,7 +1833,7 @@ namespace sdd {
 
     pugi::xml_node wtrMnTempSchRefElement = element.child("WtrMnTempSchRef");
     if (wtrMnTempSchRefElement) {
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(wtrMnTempSchRefElement.text().as_string());
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, wtrMnTempSchRefElement.text().as_string());
       if (schedule) {
         model::SiteWaterMainsTemperature waterMains = model.getUniqueModelObject<model::SiteWaterMainsTemperature>();
         waterMains.setTemperatureSchedule(*schedule);
@@ -1930,7 +1956,7 @@ namespace sdd {
     auto fluidSysElement = fluidSegmentElement.parent();
     auto fluidSysNameElement = fluidSysElement.child("Name");
 
-    return model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().as_string());
+    return getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().as_string());
   }
 
   boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSupplySegment(const pugi::xml_node& fluidSegInRefElement,
@@ -1960,7 +1986,7 @@ namespace sdd {
           if ((openstudio::istringEqual(typeElement.text().as_string(), "SECONDARYSUPPLY")
                || openstudio::istringEqual(typeElement.text().as_string(), "PRIMARYSUPPLY"))
               && openstudio::istringEqual(nameElement.text().as_string(), fluidSegmentName)) {
-            if (boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().as_string())) {
+            if (boost::optional<model::PlantLoop> loop = getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().as_string())) {
               return loop;
             } else {
               if (boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement, model)) {
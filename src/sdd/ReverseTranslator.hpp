@@ -36,6 +36,8 @@
 #include "../utilities/core/Optional.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/core/Assert.hpp"
+#include "../utilities/idf/WorkspaceObject.hpp"
 
 #include "../model/Schedule.hpp"
 #include "../model/AvailabilityManagerOptimumStart.hpp"
@@ -43,6 +45,9 @@
 #include "../model/ConstructionBase.hpp"
 #include "../model/AirConditionerVariableRefrigerantFlow.hpp"
 
+#include <functional>
+#include <memory>
+
 namespace pugi {
 class xml_node;
 class xml_document;
@@ -66,6 +71,8 @@ namespace model {
 
 namespace sdd {
 
+  class ModelObjectNameIndex;
+
   class SDD_API ReverseTranslator
   {
    public:
@@ -85,6 +92,22 @@ namespace sdd {
    private:
     std::string escapeName(std::string name);
 
+    // Same as model.getModelObjectByName<T>(name), but served from m_nameIndex while translating
+    template <typename T>
+    boost::optional<T> getModelObjectByName(const model::Model& model, const std::string& name) {
+      boost::optional<T> result;
+      std::vector<WorkspaceObject> objects =
+        objectsByName(model, name, [](const WorkspaceObject& object) { return static_cast<bool>(object.optionalCast<T>()); });
+      if (!objects.empty()) {
+        OS_ASSERT(objects.size() == 1u);
+        result = objects[0].optionalCast<T>();
+      }
+      return result;
+    }
+
+    std::vector<WorkspaceObject> objectsByName(const model::Model& model, const std::string& name,
+                                               const std::function<bool(const WorkspaceObject&)>& accept);
+
     // listed in translation order
     boost::optional<openstudio::model::Model> convert(const pugi::xml_node& root);
     boost::optional<openstudio::model::Model> translateSDD(const pugi::xml_node& root);
@@ -220,6 +243,9 @@ namespace sdd {
     // Map from vrf system to master control zone name
     std::map<std::string, model::AirConditionerVariableRefrigerantFlow> m_vrfSystemControlZones;
 
+    // Name lookups into the model being translated, see getModelObjectByName
+    std::shared_ptr<ModelObjectNameIndex> m_nameIndex;
+
     REGISTER_LOGGER("openstudio.sdd.ReverseTranslator");
   };
 
@@ -51,11 +51,16 @@
 #include "../../model/YearDescription_Impl.hpp"
 #include "../../model/RunPeriodControlSpecialDays.hpp"
 #include "../../model/RunPeriodControlSpecialDays_Impl.hpp"
+#include "../../model/ConstructionBase.hpp"
+#include "../../model/ConstructionBase_Impl.hpp"
 
+#include "../../utilities/core/Compare.hpp"
 #include "../../utilities/core/Optional.hpp"
 
 #include <resources.hxx>
 
+#include <pugixml.hpp>
+
 #include <sstream>
 
 TEST_F(SDDFixture, ReverseTranslator_load) {
@@ -69,3 +74,46 @@ TEST_F(SDDFixture, ReverseTranslator_load) {
 
   EXPECT_TRUE(_m);
 }
+
+TEST_F(SDDFixture, ReverseTranslator_NameReferences) {
+
+  openstudio::path p = resourcesPath() / openstudio::toPath("simxml/OffLrg-ThermalEnergyStorage_StoragePriority-ap.xml");
+
+  openstudio::filesystem::ifstream file(p, std::ios_base::binary);
+  ASSERT_TRUE(file.is_open());
+  pugi::xml_document doc;
+  ASSERT_TRUE(doc.load(file));
+  file.close();
+
+  openstudio::sdd::ReverseTranslator rt;
+  boost::optional<openstudio::model::Model> model = rt.loadModel(p);
+  ASSERT_TRUE(model);
+
+  // the translator resolves these references by name, every space must be in the thermal zone its ThrmlZnRef names
+  unsigned numSpaces = 0;
+  for (const pugi::xpath_node& node : doc.select_nodes("//Spc")) {
+    std::string spaceName = node.node().child("Name").text().as_string();
+    std::string thermalZoneName = node.node().child("ThrmlZnRef").text().as_string();
+    boost::optional<openstudio::model::Space> space = model->getModelObjectByName<openstudio::model::Space>(spaceName);
+    ASSERT_TRUE(space) << spaceName;
+    ASSERT_TRUE(space->thermalZone()) << spaceName;
+    EXPECT_TRUE(openstudio::istringEqual(thermalZoneName, space->thermalZone()->nameString())) << spaceName;
+    ++numSpaces;
+  }
+  EXPECT_EQ(25u, numSpaces);
+
+  // and every exterior surface must have the construction its ConsAssmRef names
+  unsigned numSurfaces = 0;
+  for (const std::string tagName : {"ExtWall", "Roof", "UndgrWall", "UndgrFlr"}) {
+    for (const pugi::xpath_node& node : doc.select_nodes(("//" + tagName).c_str())) {
+      std::string surfaceName = node.node().child("Name").text().as_string();
+      std::string constructionName = node.node().child("ConsAssmRef").text().as_string();
+      boost::optional<openstudio::model::Surface> surface = model->getModelObjectByName<openstudio::model::Surface>(surfaceName);
+      ASSERT_TRUE(surface) << surfaceName;
+      ASSERT_TRUE(surface->construction()) << surfaceName;
+      EXPECT_TRUE(openstudio::istringEqual(constructionName, surface->construction()->nameString())) << surfaceName;
+      ++numSurfaces;
+    }
+  }
+  EXPECT_EQ(38u, numSurfaces);
+}
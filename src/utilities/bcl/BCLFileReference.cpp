@@ -29,16 +29,27 @@
 
 #include "BCLFileReference.hpp"
 #include "../core/Checksum.hpp"
+#include "../core/FileContentCache.hpp"
 #include "../core/StringHelpers.hpp"
 
 #include <pugixml.hpp>
 
 namespace openstudio {
 
+namespace {
+
+  /// Returns the checksum of a file, only rehashing it when the file changed since the last call.
+  std::string cachedChecksum(const openstudio::path& p) {
+    static FileContentCache<std::string> cache;
+    return cache.get(p, [](const openstudio::path& path) { return openstudio::checksum(path); }).get();
+  }
+
+}  // namespace
+
 BCLFileReference::BCLFileReference(const openstudio::path& path, const bool setMembers) : m_path(openstudio::filesystem::system_complete(path)) {
   // DLM: why would you not want to set the members?
   if (setMembers) {
-    m_checksum = openstudio::checksum(m_path);
+    m_checksum = cachedChecksum(m_path);
 
     std::string fileType = this->fileType();
     if (fileType == "osm") {
@@ -170,7 +181,7 @@ void BCLFileReference::writeValues(pugi::xml_node& element) const {
 }
 
 bool BCLFileReference::checkForUpdate() {
-  std::string newChecksum = openstudio::checksum(this->path());
+  std::string newChecksum = cachedChecksum(this->path());
   if (m_checksum != newChecksum) {
     m_checksum = newChecksum;
     return true;
@@ -113,6 +113,7 @@ class UTILITIES_API BCLFileReference
   void writeValues(pugi::xml_node& element) const;
 
   /// Check if the file has been updated and return if so.  Will update checksum.
+  /// Files whose size and last write time are unchanged since they were last hashed are not read again.
   bool checkForUpdate();
 
   //@}
@@ -31,6 +31,7 @@
 #include "BCLFixture.hpp"
 
 #include "../BCLFileReference.hpp"
+#include "../../core/Checksum.hpp"
 
 using namespace openstudio;
 
@@ -73,3 +74,41 @@ TEST_F(BCLFixture, BCLFileReference) {
 
   EXPECT_FALSE(ref.checkForUpdate());
 }
+
+TEST_F(BCLFixture, BCLFileReference_ChecksumCache) {
+  openstudio::path path = toPath("./BCLFileReference_ChecksumCache.txt");
+  if (exists(path)) {
+    remove(path);
+  }
+  ASSERT_FALSE(exists(path));
+
+  openstudio::filesystem::ofstream file(path);
+  ASSERT_TRUE(file.is_open());
+  file << "Hi";
+  file.close();
+
+  BCLFileReference ref(path, true);
+  EXPECT_EQ(openstudio::checksum(path), ref.checksum());
+  EXPECT_FALSE(ref.checkForUpdate());
+
+  // same size, most likely written within the same second as the cached checksum
+  file.open(path);
+  ASSERT_TRUE(file.is_open());
+  file << "Ho";
+  file.close();
+
+  EXPECT_TRUE(ref.checkForUpdate());
+  EXPECT_EQ(openstudio::checksum(path), ref.checksum());
+  EXPECT_FALSE(ref.checkForUpdate());
+
+  // a second reference to the same file agrees with the first
+  BCLFileReference ref2(path, true);
+  EXPECT_EQ(ref.checksum(), ref2.checksum());
+
+  ASSERT_TRUE(exists(path));
+  remove(path);
+  ASSERT_FALSE(exists(path));
+
+  EXPECT_TRUE(ref.checkForUpdate());
+  EXPECT_EQ("00000000", ref.checksum());
+}
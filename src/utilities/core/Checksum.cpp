@@ -29,7 +29,11 @@
 
 #include "Checksum.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstdint>
 #include <sstream>
+#include <vector>
 
 #include <boost/crc.hpp>
 
@@ -46,6 +50,51 @@ namespace detail {
 
     return result;
   }
+
+  typedef std::array<std::array<uint32_t, 256>, 8> Crc32Tables;
+
+  // Lookup tables for slice-by-8 CRC-32, same polynomial and reflection as boost::crc_32_type
+  const Crc32Tables& crc32Tables() {
+    static const Crc32Tables tables = []() {
+      Crc32Tables result;
+      for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t crc = i;
+        for (int j = 0; j < 8; ++j) {
+          crc = (crc & 1u) ? ((crc >> 1) ^ 0xEDB88320u) : (crc >> 1);
+        }
+        result[0][i] = crc;
+      }
+      for (size_t k = 1; k < 8; ++k) {
+        for (uint32_t i = 0; i < 256; ++i) {
+          uint32_t previous = result[k - 1][i];
+          result[k][i] = (previous >> 8) ^ result[0][previous & 0xFFu];
+        }
+      }
+      return result;
+    }();
+    return tables;
+  }
+
+  // Updates a running (pre-inverted) CRC-32 with n bytes, processing eight bytes per step
+  uint32_t crc32Update(uint32_t crc, const unsigned char* p, size_t n) {
+    const Crc32Tables& t = crc32Tables();
+    while (n >= 8) {
+      uint32_t one = crc ^ (static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) | (static_cast<uint32_t>(p[2]) << 16)
+                            | (static_cast<uint32_t>(p[3]) << 24));
+      uint32_t two = static_cast<uint32_t>(p[4]) | (static_cast<uint32_t>(p[5]) << 8) | (static_cast<uint32_t>(p[6]) << 16)
+                     | (static_cast<uint32_t>(p[7]) << 24);
+      crc = t[7][one & 0xFFu] ^ t[6][(one >> 8) & 0xFFu] ^ t[5][(one >> 16) & 0xFFu] ^ t[4][one >> 24] ^ t[3][two & 0xFFu]
+            ^ t[2][(two >> 8) & 0xFFu] ^ t[1][(two >> 16) & 0xFFu] ^ t[0][two >> 24];
+      p += 8;
+      n -= 8;
+    }
+    while (n > 0) {
+      crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xFFu];
+      ++p;
+      --n;
+    }
+    return crc;
+  }
 }  // namespace detail
 
 /// return 8 character hex checksum of string
@@ -56,24 +105,27 @@ std::string checksum(const std::string& s) {
 
 /// return 8 character hex checksum of istream
 std::string checksum(std::istream& is) {
-  boost::crc_32_type crc;
+  // read in large chunks and skip ignored characters without copying the chunk
+  const std::streamsize n = 65536;
+  std::vector<char> buffer(static_cast<size_t>(n));
+  uint32_t crc = 0xFFFFFFFFu;
   do {
-    const std::streamsize n = 1024;
-    char buffer[n];
-    is.read(buffer, n);
+    is.read(buffer.data(), n);
     std::streamsize readSize = is.gcount();
-    //crc.process_bytes(buffer, readSize);
 
-    size_t stringSize = static_cast<size_t>(readSize);
-    std::string str(buffer, stringSize);
-    str.erase(std::remove_if(str.begin(), str.end(), openstudio::detail::checksumIgnore), str.end());
-    stringSize = str.size();
-
-    crc.process_bytes(str.c_str(), stringSize);
+    // hash the runs of bytes between ignored characters
+    const char* begin = buffer.data();
+    const char* end = begin + readSize;
+    while (begin < end) {
+      const char* stop = std::find_if(begin, end, openstudio::detail::checksumIgnore);
+      crc = openstudio::detail::crc32Update(crc, reinterpret_cast<const unsigned char*>(begin), static_cast<size_t>(stop - begin));
+      begin = (stop == end) ? end : stop + 1;
+    }
   } while (is);
+  crc ^= 0xFFFFFFFFu;
 
   std::stringstream ss;
-  ss << std::hex << std::uppercase << crc.checksum();
+  ss << std::hex << std::uppercase << crc;
   std::string result = "00000000";
   std::string checksum = ss.str();
   result.replace(8 - checksum.size(), checksum.size(), checksum);
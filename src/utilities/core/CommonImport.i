@@ -24,6 +24,7 @@
 %template(StringVector) std::vector<std::string>;
 %template(StringVectorVector) std::vector<std::vector<std::string> >;
 %template(IntVectorVector) std::vector<std::vector<int> >;
+%template(DoubleVectorVector) std::vector<std::vector<double> >;
 
 %template(UnsignedSet) std::set<unsigned>;
 %template(IntSet) std::set<int>;
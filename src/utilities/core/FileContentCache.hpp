@@ -0,0 +1,109 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_CORE_FILECONTENTCACHE_HPP
+#define UTILITIES_CORE_FILECONTENTCACHE_HPP
+
+#include "Filesystem.hpp"
+#include "Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace openstudio {
+
+/**
+   * Thread safe cache of values computed from the contents of files, keyed by path.
+   *
+   * A cached value is reused as long as the size and last write time of the file are unchanged.
+   * last_write_time has a resolution of one second, so values computed in the same second as the
+   * last write are not trusted and are computed again on the next call. Files that can not be
+   * inspected are never cached.
+   */
+template <typename T>
+class FileContentCache
+{
+ public:
+  //! Returns the cached value for path, or the result of load(path) if there is no valid entry.
+  //! load must return something convertible to boost::optional<T>, an empty result is returned
+  //! but not cached.
+  template <typename Loader>
+  boost::optional<T> get(const openstudio::path& path, Loader load) {
+    boost::system::error_code ec;
+    std::uintmax_t size = openstudio::filesystem::file_size(path, ec);
+    if (ec) {
+      return load(path);
+    }
+    std::time_t lastWriteTime = openstudio::filesystem::last_write_time(path, ec);
+    if (ec) {
+      return load(path);
+    }
+
+    std::string key = toString(path);
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto it = m_entries.find(key);
+      if ((it != m_entries.end()) && (it->second.size == size) && (it->second.lastWriteTime == lastWriteTime)
+          && (it->second.computedTime > lastWriteTime)) {
+        return it->second.value;
+      }
+    }
+
+    std::time_t computedTime = std::time(nullptr);
+    boost::optional<T> result = load(path);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(key);
+    if (result) {
+      m_entries.emplace(key, Entry{size, lastWriteTime, computedTime, *result});
+    }
+    return result;
+  }
+
+ private:
+  struct Entry
+  {
+    std::uintmax_t size;
+    std::time_t lastWriteTime;
+    std::time_t computedTime;
+    T value;
+  };
+
+  std::mutex m_mutex;
+  std::unordered_map<std::string, Entry> m_entries;
+};
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_CORE_FILECONTENTCACHE_HPP
@@ -31,6 +31,7 @@
 #include "StringHelpers.hpp"
 #include "../math/FloatCompare.hpp"
 
+#include <charconv>
 #include <iomanip>
 
 namespace openstudio {
@@ -479,6 +480,35 @@ namespace string_conversions {
     return number_formatter(value, format, precision);
   }
 
+  template <typename T>
+  static bool parse_number(const char* begin, const char* end, T& value) {
+    // from_chars does not accept the '+' sign that stream extraction and strtod do
+    if ((begin != end) && (*begin == '+')) {
+      ++begin;
+      if ((begin != end) && (*begin == '-')) {
+        return false;
+      }
+    }
+    if (begin == end) {
+      return false;
+    }
+    T result;
+    auto [ptr, ec] = std::from_chars(begin, end, result);
+    if ((ec != std::errc()) || (ptr != end)) {
+      return false;
+    }
+    value = result;
+    return true;
+  }
+
+  bool parse(const char* begin, const char* end, double& value) {
+    return parse_number(begin, end, value);
+  }
+
+  bool parse(const char* begin, const char* end, int& value) {
+    return parse_number(begin, end, value);
+  }
+
 }  // namespace string_conversions
 
 }  // namespace openstudio
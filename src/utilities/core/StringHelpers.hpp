@@ -152,6 +152,14 @@ namespace string_conversions {
   UTILITIES_API std::string number(std::uint64_t, int base = 10);
   UTILITIES_API std::string number(double, FloatFormat format = FloatFormat::general, int precision = 6);
 
+  /** Parses the whole of [begin, end) as a number. Unlike stringstream and strtod this does not depend on the
+     *  locale, does not allocate and does not need a null terminated string. Returns false, leaving value unchanged,
+     *  if the range is empty, holds anything besides the number (including whitespace), or the number is out of range.
+     *  A leading '+' is accepted.
+     */
+  UTILITIES_API bool parse(const char* begin, const char* end, double& value);
+  UTILITIES_API bool parse(const char* begin, const char* end, int& value);
+
   template <typename DesiredType, typename InputType>
   boost::optional<DesiredType> to_no_throw(const InputType& inp) {
     std::stringstream ss;
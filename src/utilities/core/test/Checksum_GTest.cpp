@@ -32,9 +32,16 @@
 #include "../Checksum.hpp"
 #include "../UUID.hpp"
 #include "../Containers.hpp"
+#include "../Logger.hpp"
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <random>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -121,3 +128,58 @@ TEST(Checksum, UUIDs) {
     EXPECT_TRUE(std::find(itStart, itEnd, *it) == itEnd);
   }
 }
+
+namespace {
+
+// reference implementation, the original boost based checksum
+std::string boostChecksum(const std::string& s) {
+  std::string str(s);
+  str.erase(std::remove(str.begin(), str.end(), '\r'), str.end());
+  boost::crc_32_type crc;
+  crc.process_bytes(str.data(), str.size());
+  stringstream ss;
+  ss << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << crc.checksum();
+  return ss.str();
+}
+
+}  // namespace
+
+TEST(Checksum, MatchesBoost) {
+  std::mt19937 gen(1234);
+  std::uniform_int_distribution<int> dist(0, 255);
+
+  // lengths around the 8 byte step and the read buffer size
+  for (size_t length : {0, 1, 7, 8, 9, 15, 16, 17, 1000, 65535, 65536, 65537, 200000}) {
+    std::string s(length, '\0');
+    for (char& c : s) {
+      c = static_cast<char>(dist(gen));
+    }
+    EXPECT_EQ(boostChecksum(s), checksum(s)) << "length = " << length;
+
+    stringstream ss(s);
+    EXPECT_EQ(boostChecksum(s), checksum(ss)) << "length = " << length;
+  }
+}
+
+TEST(Checksum, Throughput) {
+  // 32 MB of text with windows line endings
+  std::string line("1999,1,1,1,0,?9?9?9?9E0?9?9?9?9?9?9?9?9?9?9?9?9?9?9?9?9*9*9?9?9?9,7.2,5.6,90,100500\r\n");
+  std::string s;
+  s.reserve(32 * 1024 * 1024 + line.size());
+  while (s.size() < 32 * 1024 * 1024) {
+    s += line;
+  }
+
+  auto start = std::chrono::steady_clock::now();
+  std::string expected = boostChecksum(s);
+  auto boostEnd = std::chrono::steady_clock::now();
+  stringstream ss(s);
+  std::string result = checksum(ss);
+  auto end = std::chrono::steady_clock::now();
+
+  EXPECT_EQ(expected, result);
+
+  double mb = static_cast<double>(s.size()) / (1024.0 * 1024.0);
+  LOG_FREE(Info, "Checksum", "boost::crc_32_type: " << mb / std::chrono::duration<double>(boostEnd - start).count() << " MB/s");
+  LOG_FREE(Info, "Checksum", "checksum: " << mb / std::chrono::duration<double>(end - boostEnd).count() << " MB/s");
+}
@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../FileContentCache.hpp"
+#include "../Filesystem.hpp"
+
+#include <ctime>
+
+using namespace openstudio;
+
+TEST(FileContentCache, Get) {
+  openstudio::path p = openstudio::filesystem::system_complete(toPath("./FileContentCache_Get.txt"));
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "one";
+  }
+  // last written an hour ago, so the entries are trusted
+  std::time_t writeTime = std::time(nullptr) - 3600;
+  openstudio::filesystem::last_write_time(p, writeTime);
+
+  unsigned numLoads = 0;
+  auto load = [&numLoads](const openstudio::path& path) {
+    ++numLoads;
+    openstudio::filesystem::ifstream file(path, std::ios_base::binary);
+    std::string contents;
+    file >> contents;
+    return contents;
+  };
+
+  FileContentCache<std::string> cache;
+  EXPECT_EQ("one", cache.get(p, load).get());
+  EXPECT_EQ(1u, numLoads);
+  EXPECT_EQ("one", cache.get(p, load).get());
+  EXPECT_EQ(1u, numLoads);
+
+  // same size and last write time, the stale value is returned
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "two";
+  }
+  openstudio::filesystem::last_write_time(p, writeTime);
+  EXPECT_EQ("one", cache.get(p, load).get());
+  EXPECT_EQ(1u, numLoads);
+
+  // a new last write time invalidates the entry
+  openstudio::filesystem::last_write_time(p, writeTime + 60);
+  EXPECT_EQ("two", cache.get(p, load).get());
+  EXPECT_EQ(2u, numLoads);
+
+  // a new size invalidates the entry
+  {
+    openstudio::filesystem::ofstream file(p, std::ios_base::binary | std::ios_base::trunc);
+    file << "three";
+  }
+  openstudio::filesystem::last_write_time(p, writeTime + 60);
+  EXPECT_EQ("three", cache.get(p, load).get());
+  EXPECT_EQ(3u, numLoads);
+
+  // values computed in the same second as the last write are not trusted
+  openstudio::filesystem::last_write_time(p, std::time(nullptr) + 60);
+  EXPECT_EQ("three", cache.get(p, load).get());
+  EXPECT_EQ("three", cache.get(p, load).get());
+  EXPECT_EQ(5u, numLoads);
+
+  // empty results are not cached
+  unsigned numFailedLoads = 0;
+  auto fail = [&numFailedLoads](const openstudio::path&) {
+    ++numFailedLoads;
+    return boost::optional<std::string>();
+  };
+  openstudio::path missing = openstudio::filesystem::system_complete(toPath("./FileContentCache_Missing.txt"));
+  EXPECT_FALSE(cache.get(missing, fail));
+  EXPECT_FALSE(cache.get(p, fail));
+  EXPECT_EQ(2u, numFailedLoads);
+  EXPECT_EQ("three", cache.get(p, load).get());
+  EXPECT_EQ(6u, numLoads);
+
+  openstudio::filesystem::remove(p);
+}
@@ -425,3 +425,60 @@ TEST(String, ASCIITrimString) {
   openstudio::ascii_trim(test);
   EXPECT_EQ("hello world", test);
 }
+
+TEST(String, ParseNumbers) {
+  using openstudio::string_conversions::parse;
+
+  auto parseDouble = [](const std::string& s) -> boost::optional<double> {
+    double value;
+    if (parse(s.data(), s.data() + s.size(), value)) {
+      return value;
+    }
+    return boost::none;
+  };
+  auto parseInt = [](const std::string& s) -> boost::optional<int> {
+    int value;
+    if (parse(s.data(), s.data() + s.size(), value)) {
+      return value;
+    }
+    return boost::none;
+  };
+
+  EXPECT_EQ(1.5, parseDouble("1.5").value());
+  EXPECT_EQ(-1.5, parseDouble("-1.5").value());
+  EXPECT_EQ(1.5, parseDouble("+1.5").value());
+  EXPECT_EQ(0.25, parseDouble(".25").value());
+  EXPECT_EQ(1200.0, parseDouble("1.2e3").value());
+  EXPECT_EQ(3.0, parseDouble("3").value());
+  EXPECT_FALSE(parseDouble(""));
+  EXPECT_FALSE(parseDouble("+"));
+  EXPECT_FALSE(parseDouble("+-1"));
+  EXPECT_FALSE(parseDouble(" 1"));
+  EXPECT_FALSE(parseDouble("1,5"));
+  EXPECT_FALSE(parseDouble("1.5a"));
+  EXPECT_FALSE(parseDouble("1e999"));
+
+  EXPECT_EQ(42, parseInt("42").value());
+  EXPECT_EQ(-42, parseInt("-42").value());
+  EXPECT_EQ(42, parseInt("+42").value());
+  EXPECT_FALSE(parseInt("4.2"));
+  EXPECT_FALSE(parseInt("99999999999"));
+
+  // only the range is read, the number does not need to be null terminated
+  std::string fields = "12\t3.5";
+  int i = 0;
+  double d = 0.0;
+  EXPECT_TRUE(parse(fields.data(), fields.data() + 2, i));
+  EXPECT_EQ(12, i);
+  EXPECT_TRUE(parse(fields.data() + 3, fields.data() + fields.size(), d));
+  EXPECT_EQ(3.5, d);
+
+  // the global locale does not change the decimal separator
+  std::locale previous = std::locale::global(std::locale::classic());
+  try {
+    std::locale::global(std::locale("de_DE.UTF-8"));
+  } catch (const std::runtime_error&) {
+  }
+  EXPECT_EQ(1.5, parseDouble("1.5").value());
+  std::locale::global(previous);
+}
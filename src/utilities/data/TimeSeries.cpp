@@ -300,11 +300,18 @@ namespace detail {
       // unsigned numDateTimes = dateTimes.size();
       boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
 
+      // convert to compact timestamps once, all comparisons and differences below are integer operations
+      TimestampVector timestamps;
+      timestamps.reserve(dateTimes.size());
+      for (const DateTime& dateTime : dateTimes) {
+        timestamps.push_back(Timestamp::fromDateTime(dateTime));
+      }
+
       // Check for wrap around
       m_wrapAround = false;
       if (!calendarYear) {
-        for (unsigned i = 1; i < dateTimes.size(); i++) {
-          if (dateTimes[i] < dateTimes[i - 1]) {
+        for (unsigned i = 1; i < timestamps.size(); i++) {
+          if (timestamps[i] < timestamps[i - 1]) {
             m_wrapAround = true;
             break;
           }
@@ -316,28 +323,27 @@ namespace detail {
         m_secondsFromFirstReport[0] = 0;
         m_secondsFromStart[0] = 0;
         int delta = 0;
-        DateTime firstReportDateTimeWithYear =
-          DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()),
-                   m_firstReportDateTime.time());
+        int firstYear = m_firstReportDateTime.date().year();
+        Timestamp firstReportTimestampWithYear =
+          Timestamp::fromCivil(firstYear, month(m_firstReportDateTime.date().monthOfYear()), m_firstReportDateTime.date().dayOfMonth(), 0, 0,
+                               m_firstReportDateTime.time().totalSeconds());
         for (unsigned i = 1; i < dateTimes.size(); i++) {
-          DateTime wrappedDateTime =
-            DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(), m_firstReportDateTime.date().year() + delta),
-                     dateTimes[i].time());
-          if (wrappedDateTime < dateTimes[i - 1]) {
+          Date date = dateTimes[i].date();
+          int secondsOfDay = dateTimes[i].time().totalSeconds();
+          Timestamp wrappedTimestamp = Timestamp::fromCivil(firstYear + delta, month(date.monthOfYear()), date.dayOfMonth(), 0, 0, secondsOfDay);
+          if (wrappedTimestamp < timestamps[i - 1]) {
             ++delta;
-            wrappedDateTime =
-              DateTime(Date(dateTimes[i].date().monthOfYear(), dateTimes[i].date().dayOfMonth(), m_firstReportDateTime.date().year() + delta),
-                       dateTimes[i].time());
+            wrappedTimestamp = Timestamp::fromCivil(firstYear + delta, month(date.monthOfYear()), date.dayOfMonth(), 0, 0, secondsOfDay);
           }
-          m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-          m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
+          m_secondsFromFirstReport[i] = static_cast<long>(wrappedTimestamp - firstReportTimestampWithYear);
+          m_secondsFromStart[i] = m_secondsFromFirstReport[i];
         }
       } else {
         m_secondsFromFirstReport[0] = 0;
         m_secondsFromStart[0] = 0;
-        for (unsigned i = 1; i < dateTimes.size(); i++) {
-          m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-          m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
+        for (unsigned i = 1; i < timestamps.size(); i++) {
+          m_secondsFromFirstReport[i] = static_cast<long>(timestamps[i] - timestamps[0]);
+          m_secondsFromStart[i] = m_secondsFromFirstReport[i];
         }
       }
 
@@ -469,6 +475,16 @@ namespace detail {
     return dateTimeObjs;
   }
 
+  TimestampVector TimeSeries_Impl::timestamps() const {
+    Timestamp firstReport = Timestamp::fromDateTime(m_firstReportDateTime);
+    TimestampVector result;
+    result.reserve(m_secondsFromFirstReport.size());
+    for (long seconds : m_secondsFromFirstReport) {
+      result.push_back(firstReport + seconds);
+    }
+    return result;
+  }
+
   /// time in days from end of the first reporting interval
   Vector TimeSeries_Impl::daysFromFirstReport() const {
     Vector daysFromFirstReport(m_secondsFromFirstReport.size());
@@ -857,6 +873,10 @@ openstudio::DateTimeVector TimeSeries::dateTimes() const {
   return m_impl->dateTimes();
 }
 
+openstudio::TimestampVector TimeSeries::timestamps() const {
+  return m_impl->timestamps();
+}
+
 openstudio::DateTime TimeSeries::firstReportDateTime() const {
   return m_impl->firstReportDateTime();
 }
@@ -36,6 +36,7 @@
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
 #include "../time/DateTime.hpp"
+#include "../time/Timestamp.hpp"
 
 #include <boost/optional.hpp>
 #include <boost/function.hpp>
@@ -72,6 +73,8 @@ namespace detail {
 
     DateTimeVector dateTimes() const;
 
+    TimestampVector timestamps() const;
+
     openstudio::Vector daysFromFirstReport() const;
 
     double daysFromFirstReport(const unsigned& i) const;
@@ -226,6 +229,9 @@ class UTILITIES_API TimeSeries
   /// Returns the date and times at which values are reported, these are the end of each reporting interval
   openstudio::DateTimeVector dateTimes() const;
 
+  /// Returns the same report times as dateTimes() as compact timestamps, dates without a base year use their assumed base year
+  openstudio::TimestampVector timestamps() const;
+
   /// Returns the date and time of first report value
   openstudio::DateTime firstReportDateTime() const;
 
@@ -11,6 +11,9 @@
 
 %ignore openstudio::detail;
 
+// Timestamp is an internal time axis type, bindings use dateTimes()
+%ignore openstudio::TimeSeries::timestamps;
+
 %template(TimeSeriesPtr) std::shared_ptr<openstudio::TimeSeries>;
 
 // create an instantiation of the optional class
@@ -33,73 +33,201 @@
 #include "../core/Assert.hpp"
 #include "../core/PathHelpers.hpp"
 #include "../core/Checksum.hpp"
+#include "../core/StringHelpers.hpp"
 #include "../data/Variant.hpp"
 #include "../data/Vector.hpp"
 #include "../time/DateTime.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iostream>
-
-#include <boost/regex.hpp>
+#include <thread>
 
 namespace openstudio {
 namespace detail {
 
-  CSVFile_Impl::CSVFile_Impl() : m_numColumns(0) {}
+  unsigned CSVFile_Impl::Column::size() const {
+    return types.size();
+  }
 
-  CSVFile_Impl::CSVFile_Impl(const std::string& s) {
-    std::istringstream ss(s);
+  void CSVFile_Impl::Column::pushNumber(double value, CellType type) {
+    types.push_back(type);
+    values.push_back(value);
+    if (numStrings > 0) {
+      strings.emplace_back();
+    }
+  }
 
-    // will throw on error
-    m_rows = parseRows(ss);
+  void CSVFile_Impl::Column::pushString(std::string value) {
+    if (numStrings == 0) {
+      strings.resize(types.size());
+    }
+    types.push_back(StringCell);
+    values.push_back(0.0);
+    strings.push_back(std::move(value));
+    ++numStrings;
+  }
+
+  void CSVFile_Impl::Column::pushBlank(unsigned n) {
+    if (n == 0) {
+      return;
+    }
+    if (numStrings == 0) {
+      strings.resize(types.size());
+    }
+    types.insert(types.end(), n, StringCell);
+    values.insert(values.end(), n, 0.0);
+    strings.resize(strings.size() + n);
+    numStrings += n;
+  }
+
+  void CSVFile_Impl::Column::pushVariant(const Variant& value) {
+    switch (value.variantType().value()) {
+      case VariantType::Boolean:
+        pushNumber(value.valueAsBoolean() ? 1.0 : 0.0, BooleanCell);
+        break;
+      case VariantType::Integer:
+        pushNumber(value.valueAsInteger(), IntegerCell);
+        break;
+      case VariantType::Double:
+        pushNumber(value.valueAsDouble(), DoubleCell);
+        break;
+      default:
+        pushString(value.valueAsString());
+        break;
+    }
+  }
+
+  void CSVFile_Impl::Column::pushField(const char* begin, const char* end) {
+    std::size_t length = end - begin;
+
+    // quoted fields are always strings
+    if ((length >= 2) && (*begin == '"') && (*(end - 1) == '"')) {
+      pushString(std::string(begin + 1, end - 1));
+      return;
+    }
+
+    // integer: -?[0-9]+, double: [+-]?[0-9]+(\.[0-9]*)?
+    const char* p = begin;
+    bool hasSign = false;
+    if ((p != end) && ((*p == '-') || (*p == '+'))) {
+      hasSign = true;
+      ++p;
+    }
+    const char* digits = p;
+    while ((p != end) && (*p >= '0') && (*p <= '9')) {
+      ++p;
+    }
+    bool isNumber = (p != digits);
+    bool isInteger = isNumber && (p == end) && (!hasSign || (*begin == '-'));
+    if (isNumber && !isInteger && (p != end) && (*p == '.')) {
+      ++p;
+      while ((p != end) && (*p >= '0') && (*p <= '9')) {
+        ++p;
+      }
+    }
+    isNumber = isNumber && (p == end);
+
+    if (isNumber) {
+      if (isInteger) {
+        int value;
+        if (string_conversions::parse(begin, end, value)) {
+          pushNumber(static_cast<double>(value), IntegerCell);
+          return;
+        }
+      }
+      double value = 0.0;
+      string_conversions::parse(begin, end, value);
+      pushNumber(value, DoubleCell);
+      return;
+    }
+
+    pushString(std::string(begin, end));
+  }
+
+  void CSVFile_Impl::Column::append(const Column& other) {
+    if ((other.numStrings > 0) && (numStrings == 0)) {
+      strings.resize(types.size());
+    }
+    types.insert(types.end(), other.types.begin(), other.types.end());
+    values.insert(values.end(), other.values.begin(), other.values.end());
+    if (other.numStrings > 0) {
+      strings.insert(strings.end(), other.strings.begin(), other.strings.end());
+    } else if (numStrings > 0) {
+      strings.resize(types.size());
+    }
+    numStrings += other.numStrings;
+  }
+
+  Variant CSVFile_Impl::Column::cell(unsigned row) const {
+    switch (types[row]) {
+      case BooleanCell:
+        return Variant(values[row] != 0.0);
+      case IntegerCell:
+        return Variant(static_cast<int>(values[row]));
+      case DoubleCell:
+        return Variant(values[row]);
+      default:
+        return Variant(strings[row]);
+    }
+  }
+
+  CSVFile_Impl::CSVFile_Impl() : m_numRows(0) {}
 
-    assignNumColumns();
-    padRows();
+  CSVFile_Impl::CSVFile_Impl(const std::string& s) : m_numRows(0) {
+    // will throw on error
+    m_columns = parseColumns(s, m_numRows);
   }
 
-  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) {
+  CSVFile_Impl::CSVFile_Impl(const openstudio::path& p) : m_numRows(0) {
     if (!boost::filesystem::exists(p) || !boost::filesystem::is_regular_file(p)) {
       LOG_AND_THROW("Path '" << p << "' is not a CSVFile file");
     }
 
-    // open file
-    std::ifstream ifs(openstudio::toSystemFilename(p));
+    // read the whole file at once
+    std::ifstream ifs(openstudio::toSystemFilename(p), std::ios::in | std::ios::binary);
+    std::string text;
+    ifs.seekg(0, std::ios::end);
+    std::streamoff size = ifs.tellg();
+    if (size > 0) {
+      text.resize(static_cast<std::size_t>(size));
+      ifs.seekg(0, std::ios::beg);
+      ifs.read(&text[0], size);
+      text.resize(static_cast<std::size_t>(ifs.gcount()));
+    }
 
     // will throw on error
-    m_rows = parseRows(ifs);
+    m_columns = parseColumns(text, m_numRows);
 
     m_path = p;
-    assignNumColumns();
-    padRows();
   }
 
   CSVFile CSVFile_Impl::clone() const {
-    CSVFile result(this->string());
-    if (m_path) {
-      result.setPath(*m_path);
-    }
-
-    return result;
+    // columns are plain data, copying them is cheaper than writing and reparsing the text
+    return CSVFile(std::make_shared<CSVFile_Impl>(*this));
   }
 
   std::string CSVFile_Impl::string() const {
-    static const boost::regex escapeItRegex(",");
-
     std::string s;
     std::stringstream result;
-    for (const auto& row : m_rows) {
-      OS_ASSERT(row.size() == m_numColumns);
-      for (size_t i = 0; i < m_numColumns; ++i) {
+    unsigned numColumns = m_columns.size();
+    for (const Column& column : m_columns) {
+      OS_ASSERT(column.size() == m_numRows);
+    }
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      for (unsigned i = 0; i < numColumns; ++i) {
+        const Column& column = m_columns[i];
 
-        switch (row[i].variantType().value()) {
-          case VariantType::Integer:
-            result << row[i].valueAsInteger();
+        switch (column.types[row]) {
+          case IntegerCell:
+            result << static_cast<int>(column.values[row]);
             break;
-          case VariantType::Double:
-            result << row[i].valueAsDouble();
+          case DoubleCell:
+            result << column.values[row];
             break;
-          case VariantType::String:
-            s = row[i].valueAsString();
-            if (boost::regex_match(s, escapeItRegex)) {
+          case StringCell:
+            s = column.strings[row];
+            if (s.find(',') != std::string::npos) {
               result << "\"" << s << "\"";
             } else {
               result << s;
@@ -109,7 +237,7 @@ namespace detail {
             break;
         }
 
-        if (i < m_numColumns - 1) {
+        if (i < numColumns - 1) {
           result << ",";
         }
       }
@@ -164,124 +292,128 @@ namespace detail {
   }
 
   unsigned CSVFile_Impl::numColumns() const {
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::numRows() const {
-    return m_rows.size();
+    return m_numRows;
   }
 
   std::vector<std::vector<Variant>> CSVFile_Impl::rows() const {
-    return m_rows;
+    std::vector<std::vector<Variant>> result;
+    result.reserve(m_numRows);
+    for (unsigned row = 0; row < m_numRows; ++row) {
+      std::vector<Variant> cells;
+      cells.reserve(m_columns.size());
+      for (const Column& column : m_columns) {
+        cells.push_back(column.cell(row));
+      }
+      result.push_back(std::move(cells));
+    }
+    return result;
   }
 
   void CSVFile_Impl::addRow(const std::vector<Variant>& row) {
-    m_rows.push_back(row);
-    if (row.size() > m_numColumns) {
-      m_numColumns = row.size();
-      padRows();
+    while (m_columns.size() < row.size()) {
+      newColumn();
     }
 
-    while (m_rows[m_rows.size() - 1].size() < m_numColumns) {
-      m_rows[m_rows.size() - 1].push_back(Variant(""));
+    unsigned numCells = row.size();
+    for (unsigned i = 0; i < numCells; ++i) {
+      m_columns[i].pushVariant(row[i]);
+    }
+    for (unsigned i = numCells; i < m_columns.size(); ++i) {
+      m_columns[i].pushBlank(1);
     }
+
+    ++m_numRows;
   }
 
   void CSVFile_Impl::setRows(const std::vector<std::vector<Variant>>& rows) {
-    m_rows = rows;
-    assignNumColumns();
+    m_columns.clear();
+    m_numRows = 0;
+    for (const auto& row : rows) {
+      addRow(row);
+    }
   }
 
   void CSVFile_Impl::clear() {
-    m_rows.clear();
+    m_columns.clear();
     m_path.reset();
-    m_numColumns = 0;
+    m_numRows = 0;
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<DateTime>& dateTimes) {
     unsigned n = dateTimes.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(dateTimes[i].toISO8601()));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    for (const DateTime& dateTime : dateTimes) {
+      column.pushString(dateTime.toISO8601());
     }
+    column.pushBlank(m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const Vector& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    Column column;
+    column.types.assign(n, DoubleCell);
+    column.values.assign(values.begin(), values.end());
+    column.pushBlank(m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<double>& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
-    }
+    Column column;
+    column.types.assign(n, DoubleCell);
+    column.values = values;
+    column.pushBlank(m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   unsigned CSVFile_Impl::addColumn(const std::vector<std::string>& values) {
     unsigned n = values.size();
     ensureNumRows(n);
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (i < n) {
-        m_rows[i].push_back(Variant(values[i]));
-      } else {
-        m_rows[i].push_back(Variant(""));
-      }
+    Column column;
+    for (const std::string& value : values) {
+      column.pushString(value);
     }
+    column.pushBlank(m_numRows - n);
+    m_columns.push_back(std::move(column));
 
-    ++m_numColumns;
-    return m_numColumns;
+    return m_columns.size();
   }
 
   std::vector<DateTime> CSVFile_Impl::getColumnAsDateTimes(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<DateTime>();
     }
 
-    std::vector<DateTime> result;
+    const Column& column = m_columns[columnIndex];
 
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-      if (m_rows[i][columnIndex].variantType() != VariantType::String) {
+    std::vector<DateTime> result;
+    result.reserve(m_numRows);
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if (column.types[i] != StringCell) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return std::vector<DateTime>();
       }
 
-      boost::optional<DateTime> dateTime = DateTime::fromISO8601(m_rows[i][columnIndex].valueAsString());
+      boost::optional<DateTime> dateTime = DateTime::fromISO8601(column.strings[i]);
       if (!dateTime) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a DateTime string");
         return std::vector<DateTime>();
@@ -293,53 +425,42 @@ namespace detail {
   }
 
   std::vector<double> CSVFile_Impl::getColumnAsDoubleVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<double>();
     }
 
-    std::vector<double> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
-
-      boost::optional<double> value;
-      if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
-        value = m_rows[i][columnIndex].valueAsDouble();
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
-        value = m_rows[i][columnIndex].valueAsInteger();
-      }
-
-      if (!value) {
+    const Column& column = m_columns[columnIndex];
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if ((column.types[i] != IntegerCell) && (column.types[i] != DoubleCell)) {
         LOG(Warn, "Value at row " << i << " and column " << columnIndex << " is not a numeric value");
         return std::vector<double>();
       }
-      result.push_back(*value);
     }
 
-    return result;
+    return column.values;
   }
 
   std::vector<std::string> CSVFile_Impl::getColumnAsStringVector(unsigned columnIndex) const {
-    if (columnIndex >= m_numColumns) {
-      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_numColumns);
+    if (columnIndex >= m_columns.size()) {
+      LOG(Warn, "Column index " << columnIndex << " invalid for number of columns " << m_columns.size());
       return std::vector<std::string>();
     }
 
-    std::vector<std::string> result;
-
-    unsigned numRows = m_rows.size();
-    for (unsigned i = 0; i < numRows; ++i) {
+    const Column& column = m_columns[columnIndex];
 
-      if (m_rows[i][columnIndex].variantType() == VariantType::String) {
-        result.push_back(m_rows[i][columnIndex].valueAsString());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Double) {
+    std::vector<std::string> result;
+    result.reserve(m_numRows);
+    for (unsigned i = 0; i < m_numRows; ++i) {
+      if (column.types[i] == StringCell) {
+        result.push_back(column.strings[i]);
+      } else if (column.types[i] == DoubleCell) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsDouble();
+        ss << column.values[i];
         result.push_back(ss.str());
-      } else if (m_rows[i][columnIndex].variantType() == VariantType::Integer) {
+      } else if (column.types[i] == IntegerCell) {
         std::stringstream ss;
-        ss << m_rows[i][columnIndex].valueAsInteger();
+        ss << static_cast<int>(column.values[i]);
         result.push_back(ss.str());
       }
     }
@@ -347,70 +468,126 @@ namespace detail {
     return result;
   }
 
-  // throws on error
-  std::vector<std::vector<Variant>> CSVFile_Impl::parseRows(std::istream& input) {
-    std::vector<std::vector<Variant>> result;
-
+  std::vector<CSVFile_Impl::Column> CSVFile_Impl::parseColumns(const std::string& text, unsigned& numRows) {
     // DLM: what conditions should make this throw?
 
-    // Excel formated CSV regex, \A[^,"]*(?=,)|(?:[^",]*"[^"]*"[^",]*)+|[^",]*"[^"]*\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\Z|\A[^,]*\Z
-    static const boost::regex csvRegex(
-      "\\A[^,\"]*(?=,)|(?:[^\",]*\"[^\"]*\"[^\",]*)+|[^\",]*\"[^\"]*\\Z|(?<=,)[^,]*(?=,)|(?<=,)[^,]*\\Z|\\A[^,]*\\Z");
-    static const boost::regex intRegex("^[-0-9]+$");
-    static const boost::regex doubleRegex("^[+-]?\\d+\\.?(\\d+)?$");
-    static const boost::regex quoteRegex("^\"(.*)\"$");
-
-    std::string line;
-    while (std::getline(input, line)) {
-      std::vector<Variant> row;
-      boost::regex_token_iterator<std::string::iterator> it{line.begin(), line.end(), csvRegex, 0};
-      boost::regex_token_iterator<std::string::iterator> end;
-      while (it != end) {
-        std::string value = *it;
-        if (boost::regex_match(value, intRegex)) {
-          row.push_back(Variant(std::stoi(value)));
-        } else if (boost::regex_match(value, doubleRegex)) {
-          row.push_back(Variant(std::stod(value)));
+    // below this size thread start up costs more than it saves
+    static constexpr std::size_t minBytesPerThread = 1 << 20;
+
+    const char* begin = text.data();
+    const char* end = begin + text.size();
+
+    unsigned numThreads = std::max(1u, std::thread::hardware_concurrency());
+    numThreads = std::min<std::size_t>(numThreads, text.size() / minBytesPerThread + 1);
+
+    if (numThreads <= 1) {
+      std::vector<Column> result;
+      numRows = 0;
+      parseLines(begin, end, result, numRows);
+      return result;
+    }
+
+    // split at line boundaries
+    std::vector<const char*> bounds{begin};
+    for (unsigned i = 1; i < numThreads; ++i) {
+      const char* p = std::max(bounds.back(), begin + i * (text.size() / numThreads));
+      p = static_cast<const char*>(std::memchr(p, '\n', end - p));
+      if (!p) {
+        break;
+      }
+      bounds.push_back(p + 1);
+    }
+    bounds.push_back(end);
+
+    unsigned numChunks = bounds.size() - 1;
+    std::vector<std::vector<Column>> chunkColumns(numChunks);
+    std::vector<unsigned> chunkRows(numChunks, 0);
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks - 1);
+    for (unsigned i = 1; i < numChunks; ++i) {
+      threads.emplace_back([&, i]() { parseLines(bounds[i], bounds[i + 1], chunkColumns[i], chunkRows[i]); });
+    }
+    parseLines(bounds[0], bounds[1], chunkColumns[0], chunkRows[0]);
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    // merge chunks in order, padding columns that are missing from a chunk
+    std::vector<Column> result = std::move(chunkColumns[0]);
+    numRows = chunkRows[0];
+    for (unsigned i = 1; i < numChunks; ++i) {
+      std::vector<Column>& columns = chunkColumns[i];
+      while (result.size() < columns.size()) {
+        result.emplace_back();
+        result.back().pushBlank(numRows);
+      }
+      for (unsigned j = 0; j < result.size(); ++j) {
+        if (j < columns.size()) {
+          result[j].append(columns[j]);
         } else {
-          boost::smatch valueMatch;
-          if (boost::regex_search(value, valueMatch, quoteRegex)) {
-            row.push_back(Variant(valueMatch[1]));
-          } else {
-            row.push_back(Variant(value));
-          }
+          result[j].pushBlank(chunkRows[i]);
         }
-        ++it;
       }
-      result.push_back(row);
+      numRows += chunkRows[i];
     }
 
     return result;
   }
 
-  void CSVFile_Impl::assignNumColumns() {
-    m_numColumns = 0;
-    for (const auto& row : m_rows) {
-      m_numColumns = std::max<unsigned>(m_numColumns, row.size());
-    }
-  }
+  void CSVFile_Impl::parseLines(const char* begin, const char* end, std::vector<Column>& columns, unsigned& numRows) {
+    while (begin < end) {
+      const char* lineEnd = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+      if (!lineEnd) {
+        lineEnd = end;
+      }
+      const char* contentEnd = lineEnd;
+      if ((contentEnd > begin) && (*(contentEnd - 1) == '\r')) {
+        --contentEnd;
+      }
 
-  void CSVFile_Impl::ensureNumRows(unsigned numRows) {
-    // add empty cells to existing columns if needed
-    if (numRows > m_rows.size()) {
-      unsigned numRowsToAdd = numRows - m_rows.size();
-      std::vector<Variant> blankRow(m_numColumns, Variant(""));
-      for (unsigned i = 0; i < numRowsToAdd; ++i) {
-        m_rows.push_back(blankRow);
+      // split on delimiters that are not inside quotes
+      unsigned col = 0;
+      bool inQuotes = false;
+      const char* field = begin;
+      for (const char* p = begin;; ++p) {
+        if ((p == contentEnd) || ((*p == ',') && !inQuotes)) {
+          if (col == columns.size()) {
+            columns.emplace_back();
+            columns.back().pushBlank(numRows);
+          }
+          columns[col].pushField(field, p);
+          ++col;
+          if (p == contentEnd) {
+            break;
+          }
+          field = p + 1;
+        } else if (*p == '"') {
+          inQuotes = !inQuotes;
+        }
+      }
+      for (; col < columns.size(); ++col) {
+        columns[col].pushBlank(1);
       }
+      ++numRows;
+
+      begin = lineEnd + 1;
     }
-    OS_ASSERT(m_rows.size() >= numRows);
   }
 
-  void CSVFile_Impl::padRows() {
-    for (auto& row : m_rows) {
-      while (row.size() < m_numColumns) {
-        row.push_back(Variant(""));
+  CSVFile_Impl::Column& CSVFile_Impl::newColumn() {
+    m_columns.emplace_back();
+    m_columns.back().pushBlank(m_numRows);
+    return m_columns.back();
+  }
+
+  void CSVFile_Impl::ensureNumRows(unsigned numRows) {
+    // add empty cells to existing columns if needed
+    if (numRows > m_numRows) {
+      unsigned numRowsToAdd = numRows - m_numRows;
+      for (Column& column : m_columns) {
+        column.pushBlank(numRowsToAdd);
       }
+      m_numRows = numRows;
     }
   }
 
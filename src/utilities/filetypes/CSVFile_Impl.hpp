@@ -36,6 +36,9 @@
 #include "../core/Path.hpp"
 #include "../data/Vector.hpp"
 
+#include <string>
+#include <vector>
+
 namespace openstudio {
 
 class CSVFile;
@@ -104,18 +107,54 @@ namespace detail {
    private:
     REGISTER_LOGGER("openstudio.CSVFile");
 
-    // throws on error
-    static std::vector<std::vector<Variant>> parseRows(std::istream& input);
+    enum CellType : unsigned char
+    {
+      BooleanCell,
+      IntegerCell,
+      DoubleCell,
+      StringCell
+    };
 
-    void assignNumColumns();
+    // cells are stored by column, numeric cells keep their value in values so numeric columns can be returned without conversion
+    struct Column
+    {
+      std::vector<unsigned char> types;
+      std::vector<double> values;
+      // only allocated once the column holds a string cell, then has one entry per cell
+      std::vector<std::string> strings;
+      unsigned numStrings = 0;
 
-    void ensureNumRows(unsigned numRows);
+      unsigned size() const;
+
+      void pushNumber(double value, CellType type);
+
+      void pushString(std::string value);
+
+      void pushBlank(unsigned n);
+
+      void pushVariant(const Variant& value);
+
+      // classifies and stores one unparsed field
+      void pushField(const char* begin, const char* end);
 
-    void padRows();
+      void append(const Column& other);
+
+      Variant cell(unsigned row) const;
+    };
+
+    // parses CSV text into columns, large inputs are split at line boundaries and parsed on several threads
+    static std::vector<Column> parseColumns(const std::string& text, unsigned& numRows);
+
+    static void parseLines(const char* begin, const char* end, std::vector<Column>& columns, unsigned& numRows);
+
+    // adds a new column padded to the current number of rows
+    Column& newColumn();
+
+    void ensureNumRows(unsigned numRows);
 
     boost::optional<openstudio::path> m_path;
-    unsigned m_numColumns;
-    std::vector<std::vector<Variant>> m_rows;
+    unsigned m_numRows;
+    std::vector<Column> m_columns;
   };
 
 }  // namespace detail
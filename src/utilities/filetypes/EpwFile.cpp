@@ -34,6 +34,7 @@
 #include "../core/Checksum.hpp"
 #include "../core/StringHelpers.hpp"
 #include "../core/Assert.hpp"
+#include "../time/Timestamp.hpp"
 
 #include <fmt/format.h>
 
@@ -3646,6 +3647,48 @@ std::vector<EpwDesignCondition> EpwFile::designConditions() {
   return m_designs;
 }
 
+// builds the time axis for EpwFile time series from integer calendar fields, avoiding a DateTime per row
+// if keepYear is false the year is stripped and data wrapping around the end of the year is moved into the following year
+static boost::optional<TimeSeries> epwTimeSeries(const std::vector<EpwDataPoint>& data, const std::vector<unsigned>& rows,
+                                                 const std::vector<double>& values, bool keepYear, int recordsPerHour, const std::string& units) {
+  if (values.empty()) {
+    return boost::none;
+  }
+
+  const EpwDataPoint& first = data[rows.front()];
+  DateTime firstReportDateTime;
+  int year;
+  if (keepYear) {
+    firstReportDateTime = DateTime(first.date(), first.time());
+    year = first.year();
+  } else {
+    Date firstDate(MonthOfYear(first.month()), first.day());
+    firstReportDateTime = DateTime(firstDate, first.time());
+    year = firstDate.year();
+  }
+
+  std::vector<long> secondsFromStart;
+  secondsFromStart.reserve(rows.size());
+  Timestamp start = Timestamp::fromCivil(year, first.month(), first.day(), first.hour(), first.minute()) - 3600 / recordsPerHour;
+  Timestamp previous = start;
+  for (unsigned row : rows) {
+    const EpwDataPoint& point = data[row];
+    if (keepYear) {
+      year = point.year();
+    }
+    Timestamp current = Timestamp::fromCivil(year, point.month(), point.day(), point.hour(), point.minute());
+    if (!keepYear && (current < previous)) {
+      // data wraps around the end of the year
+      ++year;
+      current = Timestamp::fromCivil(year, point.month(), point.day(), point.hour(), point.minute());
+    }
+    secondsFromStart.push_back(static_cast<long>(current - start));
+    previous = current;
+  }
+
+  return TimeSeries(firstReportDateTime, secondsFromStart, openstudio::createVector(values), units);
+}
+
 boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
   if (m_data.size() == 0) {
     if (!openstudio::filesystem::exists(m_path) || !openstudio::filesystem::is_regular_file(m_path)) {
@@ -3674,28 +3717,19 @@ boost::optional<TimeSeries> EpwFile::getTimeSeries(const std::string& name) {
   }
   if (m_data.size() > 0) {
     std::string units = EpwDataPoint::getUnits(id);
-    DateTimeVector dates;
-    dates.push_back(DateTime());  // Use a placeholder to avoid an insert
+    std::vector<unsigned> rows;
     std::vector<double> values;
+    rows.reserve(m_data.size());
+    values.reserve(m_data.size());
     for (unsigned int i = 0; i < m_data.size(); i++) {
-      DateTime dateTime = m_data[i].dateTime();
-      // Time time=m_data[i].time();
       boost::optional<double> value = m_data[i].getField(id);
       if (value) {
-        if (isActual()) {
-          dates.push_back(DateTime(dateTime));
-        } else {
-          // Strip year
-          dates.push_back(DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time()));
-        }
+        rows.push_back(i);
         values.push_back(value.get());
       }
     }
-    if (values.size()) {
-      DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
-      dates[0] = start;  // Overwrite the placeholder
-      return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
-    }
+    // the year is stripped unless this is an actual year file
+    return epwTimeSeries(m_data, rows, values, isActual(), m_recordsPerHour, units);
   }
   return boost::none;
 }
@@ -3751,24 +3785,18 @@ boost::optional<TimeSeries> EpwFile::getComputedTimeSeries(const std::string& na
     default:
       return boost::none;
   }
-  DateTimeVector dates;
-  dates.push_back(DateTime());  // Use a placeholder to avoid an insert
+  std::vector<unsigned> rows;
   std::vector<double> values;
+  rows.reserve(m_data.size());
+  values.reserve(m_data.size());
   for (unsigned int i = 0; i < m_data.size(); i++) {
-    Date date = m_data[i].date();
-    Time time = m_data[i].time();
     boost::optional<double> value = (m_data[i].*compute)();
     if (value) {
-      dates.push_back(DateTime(date, time));
+      rows.push_back(i);
       values.push_back(value.get());
     }
   }
-  if (values.size()) {
-    DateTime start = dates[1] - Time(0, 0, 0, 3600 / m_recordsPerHour);
-    dates[0] = start;  // Overwrite the placeholder
-    return boost::optional<TimeSeries>(TimeSeries(dates, openstudio::createVector(values), units));
-  }
-  return boost::none;
+  return epwTimeSeries(m_data, rows, values, true, m_recordsPerHour, units);
 }
 
 bool EpwFile::translateToWth(openstudio::path path, std::string description) {
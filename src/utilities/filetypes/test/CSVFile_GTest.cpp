@@ -296,3 +296,65 @@ TEST(Filetypes, CSVFile_AddAndGetColumn) {
   EXPECT_EQ("2.2", getCol4[1]);
   EXPECT_EQ("0.33", getCol4[2]);
 }
+
+TEST(Filetypes, CSVFile_LargeNumeric) {
+  // large enough to be parsed on several threads
+  const unsigned numRows = 35040;
+  const unsigned numColumns = 10;
+  std::stringstream ss;
+  for (unsigned i = 0; i < numRows; ++i) {
+    for (unsigned j = 0; j < numColumns; ++j) {
+      if (j > 0) {
+        ss << ",";
+      }
+      ss << i << "." << j;
+    }
+    ss << "\r\n";
+  }
+  // a short row and a quoted field near the end
+  ss << "1,\"2,3\"\n";
+
+  CSVFile csvFile(ss.str());
+  ASSERT_EQ(numRows + 1, csvFile.numRows());
+  ASSERT_EQ(numColumns, csvFile.numColumns());
+
+  std::vector<double> column = csvFile.getColumnAsDoubleVector(3);
+  EXPECT_TRUE(column.empty());
+
+  std::vector<std::string> strings = csvFile.getColumnAsStringVector(1);
+  ASSERT_EQ(numRows + 1, strings.size());
+  EXPECT_EQ("2,3", strings.back());
+  EXPECT_EQ("", csvFile.getColumnAsStringVector(9).back());
+
+  csvFile.clear();
+  for (unsigned j = 0; j < numColumns; ++j) {
+    std::vector<double> values;
+    for (unsigned i = 0; i < numRows; ++i) {
+      // string() writes doubles with the default stream precision of 6 significant digits
+      values.push_back((i % 100) + 0.125 * j);
+    }
+    csvFile.addColumn(values);
+  }
+  CSVFile csvFile2(csvFile.string());
+  ASSERT_EQ(numRows, csvFile2.numRows());
+  ASSERT_EQ(numColumns, csvFile2.numColumns());
+  for (unsigned j = 0; j < numColumns; ++j) {
+    column = csvFile2.getColumnAsDoubleVector(j);
+    ASSERT_EQ(numRows, column.size());
+    EXPECT_EQ(csvFile.getColumnAsDoubleVector(j), column);
+  }
+
+  // clone copies the columns
+  CSVFile clone = csvFile2.clone();
+  EXPECT_EQ(csvFile2.string(), clone.string());
+  clone.addColumn(std::vector<double>(1, 1.0));
+  EXPECT_EQ(numColumns, csvFile2.numColumns());
+  EXPECT_EQ(numColumns + 1, clone.numColumns());
+}
+
+TEST(Filetypes, CSVFile_DoubleFormat) {
+  // doubles are written like a default std::ostream, with 6 significant digits
+  CSVFile csvFile;
+  csvFile.addColumn(std::vector<double>{0.5, 1.0 / 3.0, 1234567.0, 8760.0});
+  EXPECT_EQ("0.5\n0.333333\n1.23457e+06\n8760\n", csvFile.string());
+}
@@ -483,9 +483,9 @@ void FloorplanJS::makeGeometries(const Json::Value& story, const Json::Value& sp
   std::vector<Point3d> doorCenterVertices;
   std::vector<std::string> doorDefinitionIds;
 
-  const Json::Value windowDefinitions = m_value.get("window_definitions", Json::arrayValue);
-  const Json::Value daylightingControlDefinitions = m_value.get("daylighting_control_definitions", Json::arrayValue);
-  const Json::Value doorDefinitions = m_value.get("door_definitions", Json::arrayValue);
+  const Json::Value& windowDefinitions = m_value["window_definitions"];
+  const Json::Value& daylightingControlDefinitions = m_value["daylighting_control_definitions"];
+  const Json::Value& doorDefinitions = m_value["door_definitions"];
 
   // get all the windows on this story unless this is a plenum
   std::map<std::string, std::vector<Json::Value>> edgeIdToWindowsMap;
@@ -1047,6 +1047,7 @@ ThreeModelObjectMetadata FloorplanJS::makeModelObjectMetadata(const std::string&
 ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const {
   m_plenumThermalZoneNames.clear();
   m_boundingBox = BoundingBox();
+  m_objectIndexes.clear();
 
   std::vector<ThreeGeometry> geometries;
   std::vector<ThreeSceneChild> children;
@@ -1091,7 +1092,7 @@ ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const {
   bool anyPlenums = false;
 
   // loop over stories
-  Json::Value stories = m_value.get("stories", Json::arrayValue);
+  const Json::Value& stories = m_value["stories"];
   Json::ArrayIndex storyN = stories.size();
   for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx) {
 
@@ -1158,10 +1159,10 @@ ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const {
 
     // get the geometry
     assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
-    Json::Value geometry = stories[storyIdx].get("geometry", Json::arrayValue);
-    Json::Value vertices = geometry.get("vertices", Json::arrayValue);
-    Json::Value edges = geometry.get("edges", Json::arrayValue);
-    Json::Value faces = geometry.get("faces", Json::arrayValue);
+    const Json::Value& geometry = stories[storyIdx]["geometry"];
+    const Json::Value& vertices = geometry["vertices"];
+    const Json::Value& edges = geometry["edges"];
+    const Json::Value& faces = geometry["faces"];
 
     // loop over spaces
     Json::Value spaces = stories[storyIdx].get("spaces", Json::arrayValue);
@@ -1613,6 +1614,8 @@ void FloorplanJS::updateStories(const std::vector<FloorplanObject>& objects, boo
 }
 
 void FloorplanJS::updateSpaces(const std::vector<FloorplanObject>& objects, bool removeMissingObjects) {
+  m_objectIndexes.clear();
+
   std::map<std::string, std::vector<FloorplanObject>> storyHandleToSpaceObejctIds;
 
   for (const auto& object : objects) {
@@ -1708,17 +1711,88 @@ void FloorplanJS::setLastId(const Json::Value& value) {
   }
 }
 
+std::string FloorplanJS::getObjectKey(const Json::Value& value, ObjectKey objectKey) {
+  switch (objectKey) {
+    case IdKey:
+      return getId(value);
+    case HandleKey:
+      return getHandleString(value);
+    case NameKey:
+      return getName(value);
+  }
+  return "";
+}
+
+const FloorplanJS::ObjectIndex& FloorplanJS::objectIndex(const Json::Value& values) const {
+  auto it = m_objectIndexes.find(&values);
+  if (it != m_objectIndexes.end()) {
+    return it->second;
+  }
+
+  ObjectIndex& index = m_objectIndexes[&values];
+  Json::ArrayIndex n = values.size();
+  for (Json::ArrayIndex i = 0; i < n; ++i) {
+    for (ObjectKey objectKey : {IdKey, HandleKey, NameKey}) {
+      std::string s = getObjectKey(values[i], objectKey);
+      if (!s.empty()) {
+        // keep the first match, same as a linear search
+        index[objectKey].emplace(s, i);
+      }
+    }
+  }
+  return index;
+}
+
+void FloorplanJS::indexObject(const Json::Value& values, Json::ArrayIndex i) {
+  auto it = m_objectIndexes.find(&values);
+  if (it == m_objectIndexes.end()) {
+    return;
+  }
+
+  for (ObjectKey objectKey : {IdKey, HandleKey, NameKey}) {
+    std::string s = getObjectKey(values[i], objectKey);
+    if (!s.empty()) {
+      auto inserted = it->second[objectKey].emplace(s, i);
+      if (!inserted.second && (i < inserted.first->second)) {
+        inserted.first->second = i;
+      }
+    }
+  }
+}
+
+boost::optional<Json::ArrayIndex> FloorplanJS::findIndex(const Json::Value& values, ObjectKey objectKey, const std::string& s) const {
+  if (s.empty()) {
+    return boost::none;
+  }
+
+  const auto& map = objectIndex(values)[objectKey];
+  auto it = map.find(s);
+  if (it == map.end()) {
+    return boost::none;
+  }
+
+  if ((it->second < values.size()) && (getObjectKey(values[it->second], objectKey) == s)) {
+    return it->second;
+  }
+
+  // object was renamed since the index was built, rebuild it
+  m_objectIndexes.erase(&values);
+  const auto& rebuilt = objectIndex(values)[objectKey];
+  it = rebuilt.find(s);
+  if (it == rebuilt.end()) {
+    return boost::none;
+  }
+  return it->second;
+}
+
 Json::Value* FloorplanJS::findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString) {
   if (handleString.empty()) {
     return nullptr;
   }
 
   Json::Value& values = value[key];
-  Json::ArrayIndex n = values.size();
-  for (Json::ArrayIndex i = 0; i < n; ++i) {
-    if (getHandleString(values[i]) == handleString) {
-      return &values[i];
-    }
+  if (boost::optional<Json::ArrayIndex> i = findIndex(values, HandleKey, handleString)) {
+    return &values[*i];
   }
 
   return nullptr;
@@ -1729,18 +1803,10 @@ Json::Value* FloorplanJS::findByName(Json::Value& value, const std::string& key,
     return nullptr;
   }
 
+  // requireEmptyHandle has never been enforced, the first object with this name is returned
   Json::Value& values = value[key];
-  Json::ArrayIndex n = values.size();
-  for (Json::ArrayIndex i = 0; i < n; ++i) {
-    if (getName(values[i]) == name) {
-      // TODO: Both branches do the same!
-      // cppcheck-suppress duplicateBranch
-      if (requireEmptyHandle && getHandleString(values[i]).empty()) {
-        return &values[i];
-      } else {
-        return &values[i];
-      }
-    }
+  if (boost::optional<Json::ArrayIndex> i = findIndex(values, NameKey, name)) {
+    return &values[*i];
   }
 
   return nullptr;
@@ -1752,32 +1818,24 @@ Json::Value* FloorplanJS::findById(Json::Value& value, const std::string& key, c
   }
 
   Json::Value& values = value[key];
-  Json::ArrayIndex n = values.size();
-  for (Json::ArrayIndex i = 0; i < n; ++i) {
-    if (getId(values[i]) == id) {
-      return &values[i];
-    }
+  if (boost::optional<Json::ArrayIndex> i = findIndex(values, IdKey, id)) {
+    return &values[*i];
   }
 
   return nullptr;
 }
 
 const Json::Value* FloorplanJS::findById(const Json::Value& values, const std::string& id) const {
-  if (id.empty()) {
-    return nullptr;
-  }
-
-  Json::ArrayIndex n = values.size();
-  for (Json::ArrayIndex i = 0; i < n; ++i) {
-    if (getId(values[i]) == id) {
-      return &values[i];
-    }
+  if (boost::optional<Json::ArrayIndex> i = findIndex(values, IdKey, id)) {
+    return &values[*i];
   }
 
   return nullptr;
 }
 
 void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, const std::vector<FloorplanObject>& objects, bool removeMissingObjects) {
+  m_objectIndexes.clear();
+
   // ensure key exists
   if (!value.isMember(key)) {
     value[key] = Json::Value(Json::arrayValue);
@@ -1825,21 +1883,28 @@ void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, cons
         removeFaces(value["geometry"], faceIdsToRemove);
       }
     }
+
+    // positions have shifted
+    m_objectIndexes.clear();
   }
 
   // now update names and data
+  Json::Value& values = value[key];
   for (const auto& object : objects) {
 
-    Json::Value* v = findByHandleString(value, key, object.handleString());
-    if (v) {
+    Json::Value* v = nullptr;
+    boost::optional<Json::ArrayIndex> i = findIndex(values, HandleKey, object.handleString());
+    if (i) {
       // ensure name is the same
+      v = &values[*i];
       (*v)["name"] = object.name();
     } else {
       // find object by name only if handle is empty
-      v = findByName(value, key, object.name(), true);
+      i = findIndex(values, NameKey, object.name());
 
-      if (v) {
+      if (i) {
         // set handle
+        v = &values[*i];
         (*v)["handle"] = object.handleString();
       } else {
         // create new object
@@ -1847,7 +1912,8 @@ void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, cons
         newObject["id"] = getNextId();
         newObject["name"] = object.name();
         newObject["handle"] = object.handleString();
-        v = &(value[key].append(newObject));
+        i = values.size();
+        v = &(values.append(newObject));
       }
     }
 
@@ -1858,6 +1924,9 @@ void FloorplanJS::updateObjects(Json::Value& value, const std::string& key, cons
         (*v)[k] = data[k];
       }
 
+      // keep the index in sync with the new name, handle, or object
+      indexObject(values, *i);
+
       // update references
       for (const auto& p : object.objectReferenceMap()) {
         updateObjectReference(*v, p.first, p.second, removeMissingObjects);
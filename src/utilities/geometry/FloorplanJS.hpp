@@ -43,6 +43,9 @@
 
 #include <vector>
 #include <set>
+#include <array>
+#include <map>
+#include <unordered_map>
 #include <boost/optional.hpp>
 
 namespace openstudio {
@@ -215,6 +218,27 @@ class UTILITIES_API FloorplanJS
   // recursively traverses through value and finds the largest id
   void setLastId(const Json::Value& value);
 
+  enum ObjectKey
+  {
+    IdKey,
+    HandleKey,
+    NameKey
+  };
+
+  // position of the first object with each id, handle, and name in an array of objects
+  typedef std::array<std::unordered_map<std::string, Json::ArrayIndex>, 3> ObjectIndex;
+
+  static std::string getObjectKey(const Json::Value& value, ObjectKey objectKey);
+
+  // returns the index for values, building it on first use
+  const ObjectIndex& objectIndex(const Json::Value& values) const;
+
+  // adds values[i] to the index for values if it has been built
+  void indexObject(const Json::Value& values, Json::ArrayIndex i);
+
+  // finds the first object in values matching s, uses objectIndex instead of a linear search
+  boost::optional<Json::ArrayIndex> findIndex(const Json::Value& values, ObjectKey objectKey, const std::string& s) const;
+
   Json::Value* findByHandleString(Json::Value& value, const std::string& key, const std::string& handleString);
   Json::Value* findByName(Json::Value& value, const std::string& key, const std::string& name, bool requireEmptyHandle);
   Json::Value* findById(Json::Value& value, const std::string& key, const std::string& id);
@@ -235,6 +259,9 @@ class UTILITIES_API FloorplanJS
   unsigned m_lastId;
   mutable std::set<std::string> m_plenumThermalZoneNames;
   mutable BoundingBox m_boundingBox;
+
+  // indexes are keyed by the address of arrays in m_value, cleared on entry to toThreeScene and update methods
+  mutable std::map<const Json::Value*, ObjectIndex> m_objectIndexes;
 };
 
 /// convienence method, converts a FloorplanJS JSON string to a ThreeJS JSON string
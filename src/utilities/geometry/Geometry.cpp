@@ -35,9 +35,15 @@
 #include "../core/Assert.hpp"
 
 #include <boost/math/constants/constants.hpp>
+#include <boost/log/core.hpp>
+#include <boost/log/attributes/constant.hpp>
 
 #include <polypartition/polypartition.h>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace openstudio {
 /// convert degrees to radians
 double degToRad(double degrees) {
@@ -586,6 +592,51 @@ std::vector<std::vector<Point3d>> computeTriangulation(const Point3dVector& vert
   return result;
 }
 
+std::vector<std::vector<std::vector<Point3d>>> computeTriangulations(const std::vector<std::vector<Point3d>>& vertices,
+                                                                   const std::vector<std::vector<std::vector<Point3d>>>& holes, double tol,
+                                                                   unsigned numThreads) {
+  OS_ASSERT(vertices.size() == holes.size());
+
+  std::vector<std::vector<std::vector<Point3d>>> result(vertices.size());
+  if (vertices.empty()) {
+    return result;
+  }
+
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, vertices.size()));
+
+  // computeTriangulation only reads its inputs, each worker claims the next face and writes to its own slot
+  std::atomic<size_t> next(0);
+  auto worker = [&vertices, &holes, &result, &next, tol]() {
+    for (size_t i = next++; i < vertices.size(); i = next++) {
+      result[i] = computeTriangulation(vertices[i], holes[i], tol);
+    }
+  };
+
+  // messages logged by the workers are attributed to the calling thread, as if it had triangulated every face itself,
+  // so that log sinks filtered by thread id (e.g. those of translators) still receive them
+  const std::thread::id callerId = std::this_thread::get_id();
+  auto workerThread = [&worker, callerId]() {
+    auto threadId = boost::log::core::get()->add_thread_attribute("ThreadId", boost::log::attributes::constant<std::thread::id>(callerId));
+    worker();
+    boost::log::core::get()->remove_thread_attribute(threadId.first);
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (unsigned t = 1; t < numThreads; ++t) {
+    threads.emplace_back(workerThread);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return result;
+}
+
 std::vector<Point3d> moveVerticesTowardsPoint(const Point3dVector& vertices, const Point3d& point, double distance) {
   Point3dVector result;
   for (const Point3d& vertex : vertices) {
@@ -99,6 +99,12 @@ UTILITIES_API Point3d getCombinedPoint(const Point3d& point3d, std::vector<Point
 UTILITIES_API std::vector<std::vector<Point3d>> computeTriangulation(const std::vector<Point3d>& vertices,
                                                                      const std::vector<std::vector<Point3d>>& holes, double tol = 0.001);
 
+/// compute triangulations of many faces, each face and its holes are as in computeTriangulation
+/// faces are split across numThreads worker threads (0 uses the hardware concurrency), results are in input order
+UTILITIES_API std::vector<std::vector<std::vector<Point3d>>> computeTriangulations(const std::vector<std::vector<Point3d>>& vertices,
+                                                                                   const std::vector<std::vector<std::vector<Point3d>>>& holes,
+                                                                                   double tol = 0.001, unsigned numThreads = 0);
+
 /// move all vertices towards point by distance, pass negative distance to move away from point
 /// no guarantee that resulting polygon will be valid
 UTILITIES_API std::vector<Point3d> moveVerticesTowardsPoint(const std::vector<Point3d>& vertices, const Point3d& point, double distance);
@@ -8,6 +8,12 @@
 
 #endif
 
+// writes to std::ostream
+%ignore openstudio::ThreeSceneStreamWriter;
+
+// No wrapped type for a vector of triangulations, use computeTriangulation on each face
+%ignore openstudio::computeTriangulations;
+
 %{
   namespace openstudio{}
   using namespace openstudio;
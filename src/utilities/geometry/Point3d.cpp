@@ -33,17 +33,10 @@
 namespace openstudio {
 
 /// default constructor creates point at 0, 0, 0
-Point3d::Point3d() : m_storage(3, 0.0) {}
+Point3d::Point3d() : m_storage{0.0, 0.0, 0.0} {}
 
 /// constructor with x, y, z
-Point3d::Point3d(double x, double y, double z) : m_storage(3) {
-  m_storage[0] = x;
-  m_storage[1] = y;
-  m_storage[2] = z;
-}
-
-/// copy constructor
-Point3d::Point3d(const Point3d& other) : m_storage(other.m_storage) {}
+Point3d::Point3d(double x, double y, double z) : m_storage{x, y, z} {}
 
 /// get x
 double Point3d::x() const {
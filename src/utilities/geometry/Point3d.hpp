@@ -34,6 +34,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -51,9 +52,6 @@ class UTILITIES_API Point3d
   /// constructor with x, y, z
   Point3d(double x, double y, double z);
 
-  /// copy constructor
-  Point3d(const Point3d& other);
-
   /// get x
   double x() const;
 
@@ -80,7 +78,7 @@ class UTILITIES_API Point3d
 
  private:
   REGISTER_LOGGER("utilities.Point3d");
-  Vector m_storage;
+  std::array<double, 3> m_storage;
 };
 
 /// ostream operator
@@ -34,6 +34,10 @@
 #include <boost/optional.hpp>
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 namespace openstudio {
 
 /// Generate shed roof polygons
@@ -78,4 +82,58 @@ std::vector<std::vector<Point3d>> generateHipRoof(std::vector<Point3d>& polygon,
   return surfaces;
 }
 
+// calls generate on a copy of each polygon, polygons are claimed by worker threads and results written to their own slot
+template <class Generate>
+static std::vector<std::vector<std::vector<Point3d>>> generateRoofs(const std::vector<std::vector<Point3d>>& polygons, unsigned numThreads,
+                                                                    const Generate& generate) {
+  std::vector<std::vector<std::vector<Point3d>>> result(polygons.size());
+  if (polygons.empty()) {
+    return result;
+  }
+
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  numThreads = static_cast<unsigned>(std::min<size_t>(numThreads, polygons.size()));
+
+  std::atomic<size_t> next(0);
+  auto worker = [&polygons, &result, &next, &generate]() {
+    for (size_t i = next++; i < polygons.size(); i = next++) {
+      std::vector<Point3d> polygon = polygons[i];
+      result[i] = generate(polygon);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(numThreads - 1);
+  for (unsigned t = 1; t < numThreads; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return result;
+}
+
+std::vector<std::vector<std::vector<Point3d>>> generateShedRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                 double directionDegrees, unsigned numThreads) {
+  return generateRoofs(polygons, numThreads, [roofPitchDegrees, directionDegrees](std::vector<Point3d>& polygon) {
+    return generateShedRoof(polygon, roofPitchDegrees, directionDegrees);
+  });
+}
+
+std::vector<std::vector<std::vector<Point3d>>> generateGableRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                  unsigned numThreads) {
+  return generateRoofs(polygons, numThreads,
+                       [roofPitchDegrees](std::vector<Point3d>& polygon) { return generateGableRoof(polygon, roofPitchDegrees); });
+}
+
+std::vector<std::vector<std::vector<Point3d>>> generateHipRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                unsigned numThreads) {
+  return generateRoofs(polygons, numThreads,
+                       [roofPitchDegrees](std::vector<Point3d>& polygon) { return generateHipRoof(polygon, roofPitchDegrees); });
+}
+
 }  // namespace openstudio
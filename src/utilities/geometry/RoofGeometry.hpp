@@ -46,6 +46,19 @@ UTILITIES_API std::vector<std::vector<Point3d>> generateGableRoof(std::vector<Po
 /// Generate hip roof polygons
 UTILITIES_API std::vector<std::vector<Point3d>> generateHipRoof(std::vector<Point3d>& polygon, double roofPitchDegrees);
 
+/// Generate shed roof polygons for each footprint, footprints are split across numThreads worker threads (0 uses the hardware concurrency)
+/// Results are in input order, an empty result means that footprint failed, same as generateShedRoof
+UTILITIES_API std::vector<std::vector<std::vector<Point3d>>> generateShedRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                               double directionDegrees, unsigned numThreads = 0);
+
+/// Generate gable roof polygons for each footprint in parallel, see generateShedRoofs
+UTILITIES_API std::vector<std::vector<std::vector<Point3d>>> generateGableRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                                unsigned numThreads = 0);
+
+/// Generate hip roof polygons for each footprint in parallel, see generateShedRoofs
+UTILITIES_API std::vector<std::vector<std::vector<Point3d>>> generateHipRoofs(const std::vector<std::vector<Point3d>>& polygons, double roofPitchDegrees,
+                                                                              unsigned numThreads = 0);
+
 }  // namespace openstudio
 
 #endif  //UTILITIES_GEOMETRY_ROOFGEOMETRY_HPP
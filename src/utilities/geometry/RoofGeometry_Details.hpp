@@ -34,6 +34,10 @@
 #include <boost/optional.hpp>
 #include <boost/math/constants/constants.hpp>
 
+#include <algorithm>
+#include <memory>
+#include <set>
+
 namespace openstudio {
 constexpr double EPSILON = 1E-10;
 
@@ -140,9 +144,6 @@ class Ray2d
     Point3d s1p1 = Point3d(point) + vector;
 
     Point3d s2p0 = other->point;
-    // TODO: this is unread!
-    // cppcheck-suppress unreadVariable
-    Point3d s2p1 = Point3d(other->point) + other->vector;
 
     Vector3d u = vector;
     Vector3d v = other->vector;
@@ -223,11 +224,7 @@ class Ray2d
       // they overlap in a valid subsegment
 
       // I0 = S2_P0 + t0 * v;
-      // I1 = S2_P0 + t1 * v;
       Point3d I0 = s2p0 + t0 * v;
-      // TODO: this is unread!
-      // cppcheck-suppress unreadVariable
-      Point3d I1 = s2p0 + t1 * v;
 
       if (t0 == t1) {
         // intersect is a point
@@ -667,17 +664,41 @@ class QueueEvent
 
   struct Comparer
   {
-    bool operator()(std::shared_ptr<QueueEvent> q1, std::shared_ptr<QueueEvent> q2) const {
+    bool operator()(const std::shared_ptr<QueueEvent>& q1, const std::shared_ptr<QueueEvent>& q2) const {
       return *q1 < *q2;
     }
   };
 
-  static void insert_sorted(std::vector<std::shared_ptr<QueueEvent>>& queue, std::shared_ptr<QueueEvent> item) {
-    queue.insert(std::upper_bound(queue.begin(), queue.end(), item, QueueEvent::Comparer()), item);
+ private:
+  REGISTER_LOGGER("utilities.QueueEvent");
+};
+
+class EventQueue  // Priority queue of events by distance, events with equal distance are kept in insertion order
+{
+ public:
+  bool empty() const {
+    return m_events.empty();
+  }
+
+  std::size_t size() const {
+    return m_events.size();
+  }
+
+  const std::shared_ptr<QueueEvent>& front() const {
+    return *m_events.begin();
+  }
+
+  void pop_front() {
+    m_events.erase(m_events.begin());
+  }
+
+  void insert(const std::shared_ptr<QueueEvent>& event) {
+    // multiset inserts after any equal elements
+    m_events.insert(m_events.end(), event);
   }
 
  private:
-  REGISTER_LOGGER("utilities.QueueEvent");
+  std::multiset<std::shared_ptr<QueueEvent>, QueueEvent::Comparer> m_events;
 };
 
 class Chain  // Chains of queue events
@@ -1282,7 +1303,7 @@ static std::vector<SplitCandidate> calcOppositeEdges(std::shared_ptr<Vertex> ver
 }
 
 static void computeSplitEvents(std::shared_ptr<Vertex> vertex, const std::vector<std::shared_ptr<Edge>>& edges,
-                               std::vector<std::shared_ptr<QueueEvent>>& queue, boost::optional<double> distanceSquared) {
+                               EventQueue& queue, boost::optional<double> distanceSquared) {
   Point3d source = vertex->point;
 
   std::vector<SplitCandidate> oppositeEdges = calcOppositeEdges(vertex, edges);
@@ -1310,12 +1331,12 @@ static void computeSplitEvents(std::shared_ptr<Vertex> vertex, const std::vector
       // some of vertex event can share the same opposite
       // point
       std::shared_ptr<QueueEvent> e1(new QueueEvent(oppositeEdge.point, oppositeEdge.distance, vertex));  // SplitEvent
-      QueueEvent::insert_sorted(queue, e1);
+      queue.insert(e1);
       continue;
     }
 
     std::shared_ptr<QueueEvent> e2(new QueueEvent(oppositeEdge.point, oppositeEdge.distance, vertex, oppositeEdge.oppositeEdge));  // SplitVertexEvent
-    QueueEvent::insert_sorted(queue, e2);
+    queue.insert(e2);
     continue;
   }
 }
@@ -1347,15 +1368,15 @@ static std::shared_ptr<QueueEvent> createEdgeEvent(const Point3d& point, std::sh
 }
 
 static void computeEdgeEvents(std::shared_ptr<Vertex> previousVertex, std::shared_ptr<Vertex> nextVertex,
-                              std::vector<std::shared_ptr<QueueEvent>>& queue) {
+                              EventQueue& queue) {
   boost::optional<Point3d> point = computeIntersectionBisectors(previousVertex, nextVertex);
   if (point) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point.get(), previousVertex, nextVertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.insert(e);
   }
 }
 
-static void initEvents(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void initEvents(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                        const std::vector<std::shared_ptr<Edge>>& edges) {
   for (std::vector<std::shared_ptr<Vertex>>& lav : sLav) {
     for (std::shared_ptr<Vertex> vertex : lav) {
@@ -1429,7 +1450,7 @@ static int assertMaxNumberOfIterations(int count) {
   return count;
 }
 
-static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std::shared_ptr<QueueEvent>>& queue) {
+static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(EventQueue& queue) {
   /*
   * Loads all non obsolete events which are on one level.
   */
@@ -1437,9 +1458,9 @@ static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std:
   std::vector<std::shared_ptr<QueueEvent>> level;
 
   std::shared_ptr<QueueEvent> levelStart = nullptr;
-  while (queue.size() > 0) {
-    levelStart = queue[0];
-    queue.erase(queue.begin());
+  while (!queue.empty()) {
+    levelStart = queue.front();
+    queue.pop_front();
     // skip all obsolete events in level
     if (!levelStart->isObsolete()) {
       break;
@@ -1457,12 +1478,12 @@ static std::vector<std::shared_ptr<QueueEvent>> loadLevelEvents(std::vector<std:
 
   std::shared_ptr<QueueEvent> event = nullptr;
 
-  while (queue.size() > 0) {
-    event = queue[0];
+  while (!queue.empty()) {
+    event = queue.front();
     if (event->distance - levelStartHeight >= EPSILON) {
       break;
     }
-    queue.erase(queue.begin());
+    queue.pop_front();
     if (!event->isObsolete()) {
       level.push_back(event);
     }
@@ -1694,7 +1715,7 @@ static std::vector<LevelEvent> groupLevelEvents(std::vector<std::shared_ptr<Queu
   return ret;
 }
 
-static std::vector<LevelEvent> loadAndGroupLevelEvents(std::vector<std::shared_ptr<QueueEvent>>& queue,
+static std::vector<LevelEvent> loadAndGroupLevelEvents(EventQueue& queue,
                                                        std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   std::vector<std::shared_ptr<QueueEvent>> levelEvents = loadLevelEvents(queue);
   return groupLevelEvents(levelEvents, sLav);
@@ -1966,7 +1987,7 @@ static void mergeBeforeBaseVertex(std::shared_ptr<Vertex> base, std::vector<std:
   mergedList.erase(mergedList.begin(), mergedList.end());
 }
 
-static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> vertex, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> vertex, EventQueue& queue,
                                                       std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   /*
   * Calculate two new edge events for given vertex. Events are generated
@@ -2002,11 +2023,11 @@ static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> ve
 
   if (distance1 - EPSILON < distance2) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point1.get(), vertex, nextVertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.insert(e);
   }
   if (distance2 - EPSILON < distance1) {
     std::shared_ptr<QueueEvent> e(createEdgeEvent(point2.get(), previousVertex, vertex));
-    QueueEvent::insert_sorted(queue, e);
+    queue.insert(e);
   }
 
   if (distance1 < distance2) {
@@ -2015,13 +2036,13 @@ static boost::optional<double> computeCloserEdgeEvent(std::shared_ptr<Vertex> ve
   return distance2;
 }
 
-static void computeEvents(std::shared_ptr<Vertex> vertex, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void computeEvents(std::shared_ptr<Vertex> vertex, EventQueue& queue,
                           const std::vector<std::shared_ptr<Edge>>& edges, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   boost::optional<double> distanceSquared = computeCloserEdgeEvent(vertex, queue, sLav);
   computeSplitEvents(vertex, edges, queue, distanceSquared);
 }
 
-static std::shared_ptr<Vertex> createOppositeEdgeVertex(std::shared_ptr<Vertex> newVertex) {
+static std::shared_ptr<Vertex> createOppositeEdgeVertex(std::shared_ptr<Vertex> newVertex, std::vector<std::shared_ptr<Face>>& oppositeFaces) {
   /*
   * When opposite edge is processed we need to create copy of vertex to
   * use in opposite face. When opposite edge chain occur vertex is shared
@@ -2032,6 +2053,7 @@ static std::shared_ptr<Vertex> createOppositeEdgeVertex(std::shared_ptr<Vertex>
     new Vertex(newVertex->point, newVertex->distance, newVertex->bisector, newVertex->previousEdge, newVertex->nextEdge));
 
   std::shared_ptr<Face> oppFace(new Face());
+  oppositeFaces.push_back(oppFace);
 
   // create new empty node queue
   std::shared_ptr<FaceNode> fn(new FaceNode(vertex->point, vertex->distance, oppFace));
@@ -2060,6 +2082,7 @@ static void addFaceRight(std::shared_ptr<Vertex> newVertex, std::shared_ptr<Vert
 
 static std::shared_ptr<FaceNode> addSplitFaces(std::shared_ptr<FaceNode> lastFaceNode, const Chain& chainBegin, const Chain& chainEnd,
                                                std::shared_ptr<Vertex> newVertex, std::vector<std::shared_ptr<Face>>& faces,
+                                               std::vector<std::shared_ptr<Face>>& oppositeFaces,
                                                std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav) {
   if (chainBegin.chainType == Chain::TYPE_SINGLE_EDGE) {
     /*
@@ -2081,7 +2104,7 @@ static std::shared_ptr<FaceNode> addSplitFaces(std::shared_ptr<FaceNode> lastFac
       * vertex can store only left and right face. So we need to
       * create vertex clone to store additional back face.
       */
-      beginVertex = createOppositeEdgeVertex(newVertex);
+      beginVertex = createOppositeEdgeVertex(newVertex, oppositeFaces);
 
       /* same face in two vertex, original and in opposite edge clone */
       newVertex->rightFaceNode = beginVertex->rightFaceNode;
@@ -2111,7 +2134,7 @@ static std::shared_ptr<FaceNode> addSplitFaces(std::shared_ptr<FaceNode> lastFac
       * vertex can store only left and right face. So we need to
       * create vertex clone to store additional back face.
       */
-      endVertex = createOppositeEdgeVertex(newVertex);
+      endVertex = createOppositeEdgeVertex(newVertex, oppositeFaces);
 
       /* same face in two vertex, original and in opposite edge clone */
       newVertex->leftFaceNode = endVertex->leftFaceNode;
@@ -2159,8 +2182,8 @@ static std::vector<std::shared_ptr<Vertex>> cutLavPart(std::vector<std::shared_p
 }
 
 static void multiSplitEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav,
-                            std::vector<std::shared_ptr<QueueEvent>>& queue, const std::vector<std::shared_ptr<Edge>>& edges,
-                            std::vector<std::shared_ptr<Face>>& faces) {
+                            EventQueue& queue, const std::vector<std::shared_ptr<Edge>>& edges,
+                            std::vector<std::shared_ptr<Face>>& faces, std::vector<std::shared_ptr<Face>>& oppositeFaces) {
 
   createOppositeEdgeChains(sLav, event.chains, event.point);
 
@@ -2220,7 +2243,7 @@ static void multiSplitEvent(LevelEvent& event, std::vector<std::vector<std::shar
 
     computeEvents(newVertex, queue, edges, sLav);
 
-    lastFaceNode = addSplitFaces(lastFaceNode, chainBegin, chainEnd, newVertex, faces, sLav);
+    lastFaceNode = addSplitFaces(lastFaceNode, chainBegin, chainEnd, newVertex, faces, oppositeFaces, sLav);
   }
 
   // remove all centers of events from lav
@@ -2249,7 +2272,7 @@ static void addFaceBack(std::shared_ptr<Vertex> newVertex, std::shared_ptr<Verte
 }
 
 static void addMultiBackFaces(const std::vector<std::shared_ptr<QueueEvent>>& edgeList, std::shared_ptr<Vertex> edgeVertex,
-                              std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+                              std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                               std::vector<std::shared_ptr<Face>>& faces) {
   for (std::shared_ptr<QueueEvent> edgeEvent : edgeList) {
 
@@ -2263,7 +2286,7 @@ static void addMultiBackFaces(const std::vector<std::shared_ptr<QueueEvent>>& ed
   }
 }
 
-static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                       std::vector<std::shared_ptr<Edge>>& edges, std::vector<std::shared_ptr<Face>>& faces) {
   // lav will be removed so it is final vertex.
   std::shared_ptr<Vertex> pickVertex(new Vertex(event.point, event.distance, nullptr, nullptr, nullptr));
@@ -2273,7 +2296,7 @@ static void pickEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr
 }
 
 static void multiEdgeEvent(LevelEvent& event, std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav,
-                           std::vector<std::shared_ptr<QueueEvent>>& queue, const std::vector<std::shared_ptr<Edge>>& edges,
+                           EventQueue& queue, const std::vector<std::shared_ptr<Edge>>& edges,
                            std::vector<std::shared_ptr<Face>>& faces) {
 
   std::shared_ptr<Vertex> prevVertex = event.chain.getPreviousVertex(sLav);
@@ -2307,7 +2330,7 @@ static void multiEdgeEvent(LevelEvent& event, std::vector<std::vector<std::share
   computeEvents(edgeVertex, queue, edges, sLav);
 }
 
-static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, std::vector<std::shared_ptr<QueueEvent>>& queue,
+static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>& sLav, EventQueue& queue,
                                std::vector<std::shared_ptr<Face>>& faces) {
   for (std::vector<std::shared_ptr<Vertex>>& lav : sLav) {
     if (lav.size() == 2) {
@@ -2326,12 +2349,12 @@ static void processTwoNodeLavs(std::vector<std::vector<std::shared_ptr<Vertex>>>
   }
 }
 
-static void removeEventsUnderHeight(std::vector<std::shared_ptr<QueueEvent>>& queue, double levelHeight) {
+static void removeEventsUnderHeight(EventQueue& queue, double levelHeight) {
   while (!queue.empty()) {
-    if (queue[0]->distance > levelHeight + EPSILON) {
+    if (queue.front()->distance > levelHeight + EPSILON) {
       break;
     }
-    queue.erase(queue.begin());
+    queue.pop_front();
   }
 }
 
@@ -2344,6 +2367,24 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
   }
 }
 
+// Edges link to their neighbours in a ring and faces own their nodes, which point back to the face. None of these
+// shared_ptr cycles is released on its own, so they are broken here once the skeleton is done with them.
+static void releaseSkeletonLinks(const std::vector<std::shared_ptr<Edge>>& edges, const std::vector<std::shared_ptr<Face>>& faces,
+                                 const std::vector<std::shared_ptr<Face>>& oppositeFaces) {
+  for (const std::shared_ptr<Edge>& edge : edges) {
+    edge->next.reset();
+    edge->previous.reset();
+  }
+  for (const auto& faceList : {&faces, &oppositeFaces}) {
+    for (const std::shared_ptr<Face>& face : *faceList) {
+      for (const std::shared_ptr<FaceNode>& node : face->nodes) {
+        node->face.reset();
+      }
+      face->nodes.clear();
+    }
+  }
+}
+
 [[maybe_unused]] static std::vector<std::vector<Point3d>> doStraightSkeleton(std::vector<Point3d>& polygon, double roofPitchDegrees) {
 
   /* Straight skeleton algorithm implementation. Based on highly modified Petr
@@ -2351,11 +2392,23 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
   * Translated from https://github.com/kendzi/kendzi-math
   */
 
-  std::vector<std::shared_ptr<QueueEvent>> queue;
+  EventQueue queue;
   std::vector<std::shared_ptr<Face>> faces;
+  std::vector<std::shared_ptr<Face>> oppositeFaces;
   std::vector<std::shared_ptr<Edge>> edges;
   std::vector<std::vector<std::shared_ptr<Vertex>>> sLav;
 
+  // break the node cycles when the skeleton is done, including when it throws
+  struct SkeletonLinksRelease
+  {
+    std::vector<std::shared_ptr<Edge>>& edges;
+    std::vector<std::shared_ptr<Face>>& faces;
+    std::vector<std::shared_ptr<Face>>& oppositeFaces;
+    ~SkeletonLinksRelease() {
+      releaseSkeletonLinks(edges, faces, oppositeFaces);
+    }
+  } skeletonLinksRelease{edges, faces, oppositeFaces};
+
   double zcoord = initPolygon(polygon);
   makeCounterClockwise(polygon);
   initSlav(polygon, sLav, edges, faces);
@@ -2367,9 +2420,7 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
     // start processing skeleton level
     count = assertMaxNumberOfIterations(count);
 
-    std::sort(queue.begin(), queue.end(), QueueEvent::Comparer());
-
-    double levelHeight = queue[0]->distance;
+    double levelHeight = queue.front()->distance;
 
     std::vector<LevelEvent> levelEvents = loadAndGroupLevelEvents(queue, sLav);
 
@@ -2384,7 +2435,7 @@ static void removeEmptyLav(std::vector<std::vector<std::shared_ptr<Vertex>>>& sL
       }
 
       if (event.eventType == LevelEvent::TYPE_MULTI_SPLIT) {
-        multiSplitEvent(event, sLav, queue, edges, faces);
+        multiSplitEvent(event, sLav, queue, edges, faces, oppositeFaces);
         continue;
       } else if (event.eventType == LevelEvent::TYPE_PICK) {
         pickEvent(event, sLav, queue, edges, faces);
@@ -32,6 +32,8 @@
 
 #include "../FloorplanJS.hpp"
 #include "../ThreeJS.hpp"
+#include "../../core/Json.hpp"
+#include "../../core/UUID.hpp"
 
 #include <resources.hxx>
 
@@ -85,3 +87,119 @@ TEST_F(GeometryFixture, FloorplanJS) {
     file.close();
   }
 }
+
+TEST_F(GeometryFixture, FloorplanJS_Scaling) {
+  // one story with an n x n grid of square spaces sharing vertices and edges
+  const unsigned n = 30;
+  unsigned nextId = 1;
+  auto vertexId = [n](unsigned i, unsigned j) { return std::to_string(1 + i * (n + 1) + j); };
+  auto hEdgeId = [n](unsigned i, unsigned j) { return std::to_string(10000 + i * (n + 1) + j); };
+  auto vEdgeId = [n](unsigned i, unsigned j) { return std::to_string(20000 + i * (n + 1) + j); };
+
+  Json::Value vertices(Json::arrayValue);
+  Json::Value edges(Json::arrayValue);
+  Json::Value faces(Json::arrayValue);
+  Json::Value spaces(Json::arrayValue);
+  for (unsigned i = 0; i <= n; ++i) {
+    for (unsigned j = 0; j <= n; ++j) {
+      Json::Value vertex(Json::objectValue);
+      vertex["id"] = vertexId(i, j);
+      vertex["x"] = 10.0 * i;
+      vertex["y"] = 10.0 * j;
+      vertices.append(vertex);
+
+      if (i < n) {
+        Json::Value edge(Json::objectValue);
+        edge["id"] = hEdgeId(i, j);
+        edge["vertex_ids"].append(vertexId(i, j));
+        edge["vertex_ids"].append(vertexId(i + 1, j));
+        edges.append(edge);
+      }
+      if (j < n) {
+        Json::Value edge(Json::objectValue);
+        edge["id"] = vEdgeId(i, j);
+        edge["vertex_ids"].append(vertexId(i, j));
+        edge["vertex_ids"].append(vertexId(i, j + 1));
+        edges.append(edge);
+      }
+
+      if ((i < n) && (j < n)) {
+        std::string faceId = std::to_string(30000 + nextId);
+        Json::Value face(Json::objectValue);
+        face["id"] = faceId;
+        for (const auto& edgeId : {hEdgeId(i, j), vEdgeId(i + 1, j), hEdgeId(i, j + 1), vEdgeId(i, j)}) {
+          face["edge_ids"].append(edgeId);
+        }
+        for (unsigned edgeOrder : {1u, 1u, 0u, 0u}) {
+          face["edge_order"].append(edgeOrder);
+        }
+        faces.append(face);
+
+        Json::Value space(Json::objectValue);
+        space["id"] = std::to_string(40000 + nextId);
+        space["name"] = "Space " + std::to_string(nextId);
+        space["face_id"] = faceId;
+        spaces.append(space);
+        ++nextId;
+      }
+    }
+  }
+
+  Json::Value story(Json::objectValue);
+  story["id"] = "50000";
+  story["name"] = "Story 1";
+  story["geometry"]["id"] = "50001";
+  story["geometry"]["vertices"] = vertices;
+  story["geometry"]["edges"] = edges;
+  story["geometry"]["faces"] = faces;
+  story["spaces"] = spaces;
+
+  Json::Value root(Json::objectValue);
+  root["project"]["config"]["units"] = "ft";
+  root["stories"].append(story);
+
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(Json::writeString(Json::StreamWriterBuilder(), root));
+  ASSERT_TRUE(floorplan);
+
+  auto spaceNames = [](const ThreeScene& scene) {
+    std::set<std::string> result;
+    for (const auto& child : scene.object().children()) {
+      if (!child.userData().spaceName().empty()) {
+        result.insert(child.userData().spaceName());
+      }
+    }
+    return result;
+  };
+
+  std::set<std::string> names = spaceNames(floorplan->toThreeScene(true));
+  EXPECT_EQ(n * n, names.size());
+  EXPECT_EQ(1u, names.count("Space 1"));
+
+  // assign handles by name, then rename by handle
+  std::string storyHandle = toString(createUUID());
+  floorplan->updateStories({FloorplanObject("", "Story 1", storyHandle)}, false);
+
+  std::vector<std::string> spaceHandles;
+  std::vector<FloorplanObject> objects;
+  for (unsigned i = 1; i <= n * n; ++i) {
+    spaceHandles.push_back(toString(createUUID()));
+    FloorplanObject object("", "Space " + std::to_string(i), spaceHandles.back());
+    object.setParentHandleString(storyHandle);
+    objects.push_back(object);
+  }
+  floorplan->updateSpaces(objects, false);
+
+  objects.clear();
+  for (unsigned i = 1; i <= n * n; ++i) {
+    FloorplanObject object("", "Renamed " + std::to_string(i), spaceHandles[i - 1]);
+    object.setParentHandleString(storyHandle);
+    objects.push_back(object);
+  }
+  floorplan->updateSpaces(objects, false);
+
+  names = spaceNames(floorplan->toThreeScene(false));
+  EXPECT_EQ(n * n, names.size());
+  EXPECT_EQ(0u, names.count("Space 1"));
+  EXPECT_EQ(1u, names.count("Renamed 1"));
+  EXPECT_EQ(1u, names.count("Renamed " + std::to_string(n * n)));
+}
@@ -34,6 +34,9 @@
 #include "../Point3d.hpp"
 #include "../PointLatLon.hpp"
 #include "../Vector3d.hpp"
+#include "../../core/StringStreamLogSink.hpp"
+
+#include <thread>
 
 using namespace std;
 using namespace boost;
@@ -1014,6 +1017,61 @@ TEST_F(GeometryFixture, Triangulate_ComplexHoles) {
   EXPECT_TRUE(checkNormals(normal, test));
 }
 
+TEST_F(GeometryFixture, Triangulate_Batch) {
+  double tol = 0.01;
+
+  std::vector<std::vector<Point3d>> allVertices;
+  std::vector<std::vector<std::vector<Point3d>>> allHoles;
+  for (unsigned i = 0; i < 200; ++i) {
+    allVertices.push_back(makeRectangleDown(i, 0, 4, 4));
+    allHoles.emplace_back();
+    if (i % 2 == 1) {
+      allHoles.back().push_back(makeRectangleDown(i + 1, 1, 1, 1));
+    }
+  }
+  // fails to triangulate
+  allVertices.push_back(makeRectangleDown(1, 1, 1, 1));
+  allHoles.push_back({makeRectangleDown(0, 0, 4, 4)});
+
+  for (unsigned numThreads : {0u, 1u, 3u}) {
+    std::vector<std::vector<std::vector<Point3d>>> test = computeTriangulations(allVertices, allHoles, tol, numThreads);
+    ASSERT_EQ(allVertices.size(), test.size());
+    for (size_t i = 0; i < allVertices.size(); ++i) {
+      EXPECT_EQ(computeTriangulation(allVertices[i], allHoles[i], tol), test[i]);
+    }
+    EXPECT_DOUBLE_EQ(16.0, totalArea(test[0]));
+    EXPECT_DOUBLE_EQ(15.0, totalArea(test[1]));
+    EXPECT_TRUE(test.back().empty());
+  }
+
+  EXPECT_TRUE(computeTriangulations({}, {}, tol).empty());
+}
+
+TEST_F(GeometryFixture, Triangulate_Batch_Logging) {
+  // sinks filtered on this thread, like those of the translators, get the messages logged on the worker threads
+  StringStreamLogSink sink;
+  sink.setLogLevel(Error);
+  sink.setThreadId(std::this_thread::get_id());
+
+  // none of these are on the z = 0 plane
+  std::vector<std::vector<Point3d>> allVertices(64, {Point3d(0, 1, 1), Point3d(1, 1, 1), Point3d(1, 0, 1), Point3d(0, 0, 1)});
+  std::vector<std::vector<std::vector<Point3d>>> allHoles(allVertices.size());
+
+  std::vector<std::vector<std::vector<Point3d>>> test = computeTriangulations(allVertices, allHoles, 0.01, 4);
+  ASSERT_EQ(allVertices.size(), test.size());
+  for (const auto& triangulation : test) {
+    EXPECT_TRUE(triangulation.empty());
+  }
+
+  size_t numMessages = 0;
+  for (const LogMessage& logMessage : sink.logMessages()) {
+    if (logMessage.logMessage() == "All points must be on z = 0 plane for triangulation methods") {
+      ++numMessages;
+    }
+  }
+  EXPECT_EQ(allVertices.size(), numMessages);
+}
+
 TEST_F(GeometryFixture, PointLatLon) {
   // building in Portland
   PointLatLon origin(45.521272355398, -122.686472758865);
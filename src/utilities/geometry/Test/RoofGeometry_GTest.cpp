@@ -2911,4 +2911,84 @@ TEST_F(GeometryFixture, RoofExtendedSkeleton_8_Zoffset) {
   for (unsigned i = 0; i < roofPolygons.size(); ++i) {
     polygonMatches(expectedRoofPolygons, roofPolygons[i]);
   }
-}
\ No newline at end of file
+}
+
+TEST_F(GeometryFixture, RoofGeometry_Batch) {
+  // rectangles, L shapes and U shapes of varying size
+  std::vector<std::vector<Point3d>> footprints;
+  for (unsigned i = 0; i < 300; ++i) {
+    double w = 10.0 + (i % 7);
+    double d = 8.0 + (i % 5);
+    switch (i % 3) {
+      case 0:
+        footprints.push_back({Point3d(0, 0, 3), Point3d(w, 0, 3), Point3d(w, d, 3), Point3d(0, d, 3)});
+        break;
+      case 1:
+        footprints.push_back({Point3d(0, 0, 3), Point3d(w, 0, 3), Point3d(w, d, 3), Point3d(w / 2, d, 3), Point3d(w / 2, 2 * d, 3), Point3d(0, 2 * d, 3)});
+        break;
+      default:
+        footprints.push_back({Point3d(0, 0, 3), Point3d(3 * w, 0, 3), Point3d(3 * w, 2 * d, 3), Point3d(2 * w, 2 * d, 3), Point3d(2 * w, d, 3),
+                              Point3d(w, d, 3), Point3d(w, 2 * d, 3), Point3d(0, 2 * d, 3)});
+        break;
+    }
+  }
+  for (unsigned numThreads : {0u, 1u, 4u}) {
+    std::vector<std::vector<std::vector<Point3d>>> hipRoofs = generateHipRoofs(footprints, 30.0, numThreads);
+    std::vector<std::vector<std::vector<Point3d>>> gableRoofs = generateGableRoofs(footprints, 30.0, numThreads);
+    std::vector<std::vector<std::vector<Point3d>>> shedRoofs = generateShedRoofs(footprints, 30.0, 90.0, numThreads);
+    ASSERT_EQ(footprints.size(), hipRoofs.size());
+    ASSERT_EQ(footprints.size(), gableRoofs.size());
+    ASSERT_EQ(footprints.size(), shedRoofs.size());
+
+    for (size_t i = 0; i < footprints.size(); ++i) {
+      std::vector<Point3d> footprint = footprints[i];
+      EXPECT_EQ(generateHipRoof(footprint, 30.0), hipRoofs[i]);
+      footprint = footprints[i];
+      EXPECT_EQ(generateGableRoof(footprint, 30.0), gableRoofs[i]);
+      footprint = footprints[i];
+      EXPECT_EQ(generateShedRoof(footprint, 30.0, 90.0), shedRoofs[i]);
+    }
+
+    EXPECT_EQ(4u, hipRoofs[0].size());
+    EXPECT_FALSE(hipRoofs[1].empty());
+    EXPECT_FALSE(hipRoofs[2].empty());
+  }
+
+  // an invalid footprint fails without affecting the others
+  std::vector<std::vector<std::vector<Point3d>>> hipRoofs = generateHipRoofs({footprints[0], {Point3d(0, 0, 0), Point3d(1, 0, 0)}}, 30.0, 2);
+  ASSERT_EQ(2u, hipRoofs.size());
+  EXPECT_EQ(4u, hipRoofs[0].size());
+  EXPECT_TRUE(hipRoofs[1].empty());
+
+  EXPECT_TRUE(generateHipRoofs({}, 30.0).empty());
+}
+
+TEST_F(GeometryFixture, RoofGeometry_ReleaseSkeletonLinks) {
+  // two edges in a ring, and a face whose node points back to it
+  std::vector<std::shared_ptr<Edge>> edges{std::make_shared<Edge>(Point3d(0, 0, 0), Point3d(1, 0, 0)),
+                                           std::make_shared<Edge>(Point3d(1, 0, 0), Point3d(0, 0, 0))};
+  edges[0]->next = edges[1];
+  edges[0]->previous = edges[1];
+  edges[1]->next = edges[0];
+  edges[1]->previous = edges[0];
+  std::vector<std::shared_ptr<Face>> faces{std::make_shared<Face>()};
+  faces[0]->edge = edges[0];
+  faces[0]->nodes.push_back(std::make_shared<FaceNode>(Point3d(0, 0, 0), 0.0, faces[0]));
+  std::vector<std::shared_ptr<Face>> oppositeFaces{std::make_shared<Face>()};
+  oppositeFaces[0]->nodes.push_back(std::make_shared<FaceNode>(Point3d(1, 0, 0), 0.0, oppositeFaces[0]));
+
+  std::weak_ptr<Edge> edge = edges[0];
+  std::weak_ptr<Face> face = faces[0];
+  std::weak_ptr<FaceNode> node = faces[0]->nodes[0];
+  std::weak_ptr<Face> oppositeFace = oppositeFaces[0];
+
+  releaseSkeletonLinks(edges, faces, oppositeFaces);
+  edges.clear();
+  faces.clear();
+  oppositeFaces.clear();
+
+  EXPECT_TRUE(edge.expired());
+  EXPECT_TRUE(face.expired());
+  EXPECT_TRUE(node.expired());
+  EXPECT_TRUE(oppositeFace.expired());
+}
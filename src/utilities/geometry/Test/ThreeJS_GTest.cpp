@@ -34,6 +34,8 @@
 
 #include <resources.hxx>
 
+#include <sstream>
+
 using namespace openstudio;
 
 TEST_F(GeometryFixture, ThreeJS) {
@@ -60,3 +62,27 @@ TEST_F(GeometryFixture, ThreeJS) {
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeJS_StreamWriter) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/threejs.json");
+  boost::optional<ThreeScene> scene = ThreeScene::load(toString(p));
+  ASSERT_TRUE(scene);
+
+  std::stringstream ss;
+  ThreeSceneStreamWriter writer(ss);
+  writer.write(*scene);
+  EXPECT_TRUE(writer.finished());
+  EXPECT_EQ(scene->geometries().size(), writer.numGeometries());
+  EXPECT_EQ(0u, writer.bufferByteLength());
+  EXPECT_EQ(scene->toJSON(false), ss.str());
+  EXPECT_THROW(writer.addGeometry(scene->geometries()[0]), std::exception);
+
+  std::stringstream json;
+  std::stringstream buffer;
+  ThreeSceneStreamWriter bufferWriter(json, buffer);
+  bufferWriter.write(*scene);
+  EXPECT_EQ(buffer.str().size(), bufferWriter.bufferByteLength());
+  EXPECT_LT(0u, bufferWriter.bufferByteLength());
+  // BufferGeometry cannot be read back into a ThreeScene
+  EXPECT_FALSE(ThreeScene::load(json.str()));
+}
@@ -37,6 +37,8 @@
 
 #include <boost/math/constants/constants.hpp>
 
+#include <type_traits>
+
 using namespace std;
 using namespace boost;
 using namespace openstudio;
@@ -582,3 +584,31 @@ TEST_F(GeometryFixture, Transformation_Decompose) {
 
   EXPECT_TRUE(transformation.matrix() == test.matrix()) << transformation.matrix() << std::endl << test.matrix();
 }
+
+TEST_F(GeometryFixture, Transformation_Storage) {
+  static_assert(std::is_trivially_copyable<Point3d>::value, "Point3d should be trivially copyable");
+  static_assert(std::is_trivially_copyable<Vector3d>::value, "Vector3d should be trivially copyable");
+  static_assert(std::is_trivially_copyable<Transformation>::value, "Transformation should be trivially copyable");
+
+  Transformation transformation = Transformation::translation(Vector3d(1, 2, 3)) * Transformation::rotation(Vector3d(1, 1, 1), degToRad(30));
+
+  // vector and matrix representations round trip
+  Transformation fromVector(transformation.vector());
+  EXPECT_TRUE(transformation.matrix() == fromVector.matrix()) << transformation.matrix() << std::endl << fromVector.matrix();
+  Transformation fromMatrix(transformation.matrix());
+  EXPECT_TRUE(transformation.vector() == fromMatrix.vector());
+
+  // batch transform matches single point transform
+  Point3dVector points{Point3d(0, 0, 0), Point3d(1, 0, 0), Point3d(1, 1, 0), Point3d(0, 1, 2)};
+  Point3dVector transformed = transformation * points;
+  ASSERT_EQ(points.size(), transformed.size());
+  for (unsigned i = 0; i < points.size(); ++i) {
+    EXPECT_EQ(transformation * points[i], transformed[i]);
+  }
+
+  // inverse undoes the transformation
+  Point3dVector roundTrip = transformation.inverse() * transformed;
+  for (unsigned i = 0; i < points.size(); ++i) {
+    EXPECT_NEAR(0.0, (roundTrip[i] - points[i]).length(), 1.0e-12);
+  }
+}
@@ -37,7 +37,12 @@
 
 #include <json/json.h>
 
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
+#include <memory>
 #include <string>
 
 namespace openstudio {
@@ -1642,4 +1647,274 @@ std::vector<ThreeModelObjectMetadata> ThreeSceneMetadata::modelObjectMetadata()
   return m_modelObjectMetadata;
 }
 
+// same formatting as Json::StreamWriter, so streamed output matches ThreeScene::toJSON
+static void writeThreeJsonDouble(std::ostream& os, double value) {
+  if (!std::isfinite(value)) {
+    os << (std::isnan(value) ? "null" : (value < 0 ? "-1e+9999" : "1e+9999"));
+    return;
+  }
+  char buffer[32];
+  int n = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+  bool isInteger = true;
+  for (int i = 0; i < n; ++i) {
+    if (buffer[i] == ',') {
+      buffer[i] = '.';
+    }
+    if ((buffer[i] == '.') || (buffer[i] == 'e')) {
+      isInteger = false;
+    }
+  }
+  os.write(buffer, n);
+  if (isInteger) {
+    os << ".0";
+  }
+}
+
+static void writeThreeJsonBool(std::ostream& os, bool value) {
+  os << (value ? "true" : "false");
+}
+
+static void writeThreeJsonString(std::ostream& os, const std::string& value) {
+  os << Json::valueToQuotedString(value.c_str());
+}
+
+static void appendFloat32(std::vector<char>& bytes, double value) {
+  float f = static_cast<float>(value);
+  std::uint32_t u;
+  std::memcpy(&u, &f, sizeof(u));
+  bytes.push_back(static_cast<char>(u & 0xFF));
+  bytes.push_back(static_cast<char>((u >> 8) & 0xFF));
+  bytes.push_back(static_cast<char>((u >> 16) & 0xFF));
+  bytes.push_back(static_cast<char>((u >> 24) & 0xFF));
+}
+
+ThreeSceneStreamWriter::ThreeSceneStreamWriter(std::ostream& os)
+  : m_os(os), m_buffer(nullptr), m_numGeometries(0), m_bufferByteLength(0), m_finished(false) {
+  m_os << "{\"geometries\":[";
+}
+
+ThreeSceneStreamWriter::ThreeSceneStreamWriter(std::ostream& os, std::ostream& buffer)
+  : m_os(os), m_buffer(&buffer), m_numGeometries(0), m_bufferByteLength(0), m_finished(false) {
+  m_os << "{\"geometries\":[";
+}
+
+void ThreeSceneStreamWriter::addGeometry(const ThreeGeometry& geometry) {
+  if (m_finished) {
+    LOG_AND_THROW("Cannot add geometry after ThreeSceneStreamWriter is finished");
+  }
+
+  if (m_numGeometries > 0) {
+    m_os << ',';
+  }
+  ++m_numGeometries;
+
+  if (m_buffer) {
+    writeBufferGeometry(geometry);
+    return;
+  }
+
+  const ThreeGeometryData& data = geometry.m_data;
+
+  m_os << "{\"data\":{\"castShadow\":";
+  writeThreeJsonBool(m_os, data.m_castShadow);
+  m_os << ",\"doubleSided\":";
+  writeThreeJsonBool(m_os, data.m_doubleSided);
+  m_os << ",\"faces\":[";
+  bool first = true;
+  for (const size_t& f : data.m_faces) {
+    if (!first) {
+      m_os << ',';
+    }
+    first = false;
+    m_os << static_cast<unsigned>(f);
+  }
+  m_os << "],\"normals\":[],\"receiveShadow\":";
+  writeThreeJsonBool(m_os, data.m_receiveShadow);
+  m_os << ",\"scale\":";
+  writeThreeJsonDouble(m_os, data.m_scale);
+  m_os << ",\"uvs\":[],\"vertices\":[";
+  first = true;
+  for (const double& v : data.m_vertices) {
+    if (!first) {
+      m_os << ',';
+    }
+    first = false;
+    writeThreeJsonDouble(m_os, v);
+  }
+  m_os << "],\"visible\":";
+  writeThreeJsonBool(m_os, data.m_visible);
+  m_os << "},\"type\":";
+  writeThreeJsonString(m_os, geometry.m_type);
+  m_os << ",\"uuid\":";
+  writeThreeJsonString(m_os, geometry.m_uuid);
+  m_os << '}';
+}
+
+void ThreeSceneStreamWriter::writeBufferGeometry(const ThreeGeometry& geometry) {
+  const std::vector<double>& vertices = geometry.m_data.m_vertices;
+  const std::vector<size_t>& faces = geometry.m_data.m_faces;
+  const size_t numVertices = vertices.size() / 3;
+
+  // collect triangles as vertex indices
+  std::vector<size_t> triangles;
+  size_t n = faces.size();
+  size_t i = 0;
+  while (i < n) {
+    if (faces[i] == 0) {
+      if (i + 3 >= n) {
+        LOG(Warn, "Incomplete triangle in geometry " << geometry.m_uuid);
+        break;
+      }
+      triangles.insert(triangles.end(), faces.begin() + i + 1, faces.begin() + i + 4);
+      i += 4;
+    } else if (faces[i] == openstudioFaceFormatId()) {
+      // all remaining vertices belong to this face
+      for (size_t j = i + 2; j + 1 < n; ++j) {
+        triangles.push_back(faces[i + 1]);
+        triangles.push_back(faces[j]);
+        triangles.push_back(faces[j + 1]);
+      }
+      i = n;
+    } else {
+      LOG(Warn, "Unsupported face type " << faces[i] << " in geometry " << geometry.m_uuid);
+      break;
+    }
+  }
+
+  std::vector<char> positions;
+  std::vector<char> normals;
+  positions.reserve(triangles.size() * 3 * sizeof(float));
+  normals.reserve(triangles.size() * 3 * sizeof(float));
+  size_t count = 0;
+  for (size_t t = 0; t + 2 < triangles.size(); t += 3) {
+    if ((triangles[t] >= numVertices) || (triangles[t + 1] >= numVertices) || (triangles[t + 2] >= numVertices)) {
+      LOG(Warn, "Vertex index out of range in geometry " << geometry.m_uuid);
+      continue;
+    }
+
+    const double* a = &vertices[3 * triangles[t]];
+    const double* b = &vertices[3 * triangles[t + 1]];
+    const double* c = &vertices[3 * triangles[t + 2]];
+
+    double ux = b[0] - a[0];
+    double uy = b[1] - a[1];
+    double uz = b[2] - a[2];
+    double vx = c[0] - a[0];
+    double vy = c[1] - a[1];
+    double vz = c[2] - a[2];
+    double nx = uy * vz - uz * vy;
+    double ny = uz * vx - ux * vz;
+    double nz = ux * vy - uy * vx;
+    double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+    if (length > 0) {
+      nx /= length;
+      ny /= length;
+      nz /= length;
+    }
+
+    for (const double* p : {a, b, c}) {
+      appendFloat32(positions, p[0]);
+      appendFloat32(positions, p[1]);
+      appendFloat32(positions, p[2]);
+      appendFloat32(normals, nx);
+      appendFloat32(normals, ny);
+      appendFloat32(normals, nz);
+    }
+    count += 3;
+  }
+
+  unsigned long long positionOffset = m_bufferByteLength;
+  m_buffer->write(positions.data(), positions.size());
+  m_bufferByteLength += positions.size();
+
+  unsigned long long normalOffset = m_bufferByteLength;
+  m_buffer->write(normals.data(), normals.size());
+  m_bufferByteLength += normals.size();
+
+  m_os << "{\"data\":{\"attributes\":{\"normal\":{\"byteOffset\":" << normalOffset << ",\"count\":" << count
+       << ",\"itemSize\":3,\"type\":\"Float32Array\"},\"position\":{\"byteOffset\":" << positionOffset << ",\"count\":" << count
+       << ",\"itemSize\":3,\"type\":\"Float32Array\"}}},\"type\":\"BufferGeometry\",\"uuid\":";
+  writeThreeJsonString(m_os, geometry.m_uuid);
+  m_os << '}';
+}
+
+void ThreeSceneStreamWriter::finish(const std::vector<ThreeMaterial>& materials, const ThreeSceneMetadata& metadata,
+                                    const ThreeSceneObject& sceneObject) {
+  if (m_finished) {
+    LOG_AND_THROW("ThreeSceneStreamWriter is already finished");
+  }
+  m_finished = true;
+
+  Json::StreamWriterBuilder wbuilder;
+  // mimic the old FastWriter behavior, same as ThreeScene::toJSON
+  wbuilder["commentStyle"] = "None";
+  wbuilder["indentation"] = "";
+  std::unique_ptr<Json::StreamWriter> writer(wbuilder.newStreamWriter());
+
+  m_os << "],\"materials\":[";
+  bool first = true;
+  for (const auto& m : materials) {
+    if (!first) {
+      m_os << ',';
+    }
+    first = false;
+    writer->write(m.toJsonValue(), &m_os);
+  }
+
+  m_os << "],\"metadata\":";
+  writer->write(metadata.toJsonValue(), &m_os);
+
+  // children are written one at a time rather than as one Json::Value
+  m_os << ",\"object\":{\"children\":[";
+  first = true;
+  for (const auto& c : sceneObject.m_children) {
+    if (!first) {
+      m_os << ',';
+    }
+    first = false;
+    writer->write(c.toJsonValue(), &m_os);
+  }
+  m_os << "],\"matrix\":[";
+  first = true;
+  for (const auto& d : sceneObject.m_matrix) {
+    if (!first) {
+      m_os << ',';
+    }
+    first = false;
+    writeThreeJsonDouble(m_os, d);
+  }
+  m_os << "],\"type\":";
+  writeThreeJsonString(m_os, sceneObject.m_type);
+  m_os << ",\"uuid\":";
+  writeThreeJsonString(m_os, sceneObject.m_uuid);
+  m_os << '}';
+
+  if (m_buffer) {
+    m_os << ",\"buffers\":[{\"byteLength\":" << m_bufferByteLength << "}]";
+    m_buffer->flush();
+  }
+
+  m_os << '}';
+  m_os.flush();
+}
+
+void ThreeSceneStreamWriter::write(const ThreeScene& scene) {
+  for (const auto& g : scene.m_geometries) {
+    addGeometry(g);
+  }
+  finish(scene.m_materials, scene.m_metadata, scene.m_sceneObject);
+}
+
+unsigned ThreeSceneStreamWriter::numGeometries() const {
+  return m_numGeometries;
+}
+
+unsigned long long ThreeSceneStreamWriter::bufferByteLength() const {
+  return m_bufferByteLength;
+}
+
+bool ThreeSceneStreamWriter::finished() const {
+  return m_finished;
+}
+
 }  // namespace openstudio
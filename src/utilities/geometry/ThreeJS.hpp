@@ -39,6 +39,7 @@
 
 #include <vector>
 #include <map>
+#include <iosfwd>
 #include <boost/optional.hpp>
 
 namespace Json {
@@ -49,6 +50,7 @@ namespace openstudio {
 
 class ThreeScene;
 class ThreeMaterial;
+class ThreeSceneStreamWriter;
 
 /// enum for materials
 enum ThreeSide
@@ -119,6 +121,7 @@ class UTILITIES_API ThreeGeometryData
 
  private:
   friend class ThreeGeometry;
+  friend class ThreeSceneStreamWriter;
   ThreeGeometryData(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -144,6 +147,7 @@ class UTILITIES_API ThreeGeometry
 
  private:
   friend class ThreeScene;
+  friend class ThreeSceneStreamWriter;
   ThreeGeometry(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -173,6 +177,7 @@ class UTILITIES_API ThreeMaterial
 
  private:
   friend class ThreeScene;
+  friend class ThreeSceneStreamWriter;
   ThreeMaterial(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -373,6 +378,7 @@ class UTILITIES_API ThreeSceneChild
 
  private:
   friend class ThreeSceneObject;
+  friend class ThreeSceneStreamWriter;
   ThreeSceneChild(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -397,6 +403,7 @@ class UTILITIES_API ThreeSceneObject
 
  private:
   friend class ThreeScene;
+  friend class ThreeSceneStreamWriter;
   ThreeSceneObject(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -523,6 +530,7 @@ class UTILITIES_API ThreeSceneMetadata
 
  private:
   friend class ThreeScene;
+  friend class ThreeSceneStreamWriter;
   ThreeSceneMetadata(const Json::Value& value);
   Json::Value toJsonValue() const;
 
@@ -567,6 +575,7 @@ class UTILITIES_API ThreeScene
 
  private:
   REGISTER_LOGGER("ThreeScene");
+  friend class ThreeSceneStreamWriter;
 
   ThreeSceneMetadata m_metadata;
   std::vector<ThreeGeometry> m_geometries;
@@ -574,6 +583,54 @@ class UTILITIES_API ThreeScene
   ThreeSceneObject m_sceneObject;
 };
 
+/** ThreeSceneStreamWriter writes a ThreeScene in the same JSON format as ThreeScene::toJSON, one geometry at a time,
+  *  so that the vertices of large models never have to be held in memory all at once.
+  *
+  *  If a buffer stream is given, geometries are written as BufferGeometry with non-indexed triangle "position" and "normal"
+  *  attributes stored as little-endian Float32 arrays in the buffer.  The attributes in the JSON give the "byteOffset" and "count"
+  *  of each array instead of the values, similar to glTF buffer views, and the total size is given in "buffers".
+  *  Faces in OpenStudio format are fan triangulated, so the buffer form is only suitable for display of triangulated geometry.
+  */
+class UTILITIES_API ThreeSceneStreamWriter
+{
+ public:
+  /// write JSON to os
+  ThreeSceneStreamWriter(std::ostream& os);
+
+  /// write JSON to os and vertex data to buffer
+  ThreeSceneStreamWriter(std::ostream& os, std::ostream& buffer);
+
+  ThreeSceneStreamWriter(const ThreeSceneStreamWriter& other) = delete;
+  ThreeSceneStreamWriter& operator=(const ThreeSceneStreamWriter& other) = delete;
+
+  /// write a geometry, all geometries must be added before finish is called
+  void addGeometry(const ThreeGeometry& geometry);
+
+  /// write the materials, metadata, and scene object and close the scene, no more geometries can be added
+  void finish(const std::vector<ThreeMaterial>& materials, const ThreeSceneMetadata& metadata, const ThreeSceneObject& sceneObject);
+
+  /// write all of a ThreeScene
+  void write(const ThreeScene& scene);
+
+  unsigned numGeometries() const;
+
+  /// number of bytes written to the buffer
+  unsigned long long bufferByteLength() const;
+
+  bool finished() const;
+
+ private:
+  REGISTER_LOGGER("ThreeSceneStreamWriter");
+
+  void writeBufferGeometry(const ThreeGeometry& geometry);
+
+  std::ostream& m_os;
+  std::ostream* m_buffer;
+  unsigned m_numGeometries;
+  unsigned long long m_bufferByteLength;
+  bool m_finished;
+};
+
 }  // namespace openstudio
 
 #endif  //UTILITIES_GEOMETRY_THREEJS_HPP
@@ -35,6 +35,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -59,9 +60,6 @@ class UTILITIES_API Transformation
   /// constructor from storage, asserts vector is size 16
   Transformation(const Vector& vector);
 
-  /// copy constructor
-  Transformation(const Transformation& other);
-
   /// rotation about origin defined by axis and angle (radians)
   static Transformation rotation(const Vector3d& axis, double radians);
 
@@ -125,7 +123,8 @@ class UTILITIES_API Transformation
 
  private:
   REGISTER_LOGGER("utilities.Transformation");
-  Matrix m_storage;
+  // row major 4x4 storage
+  std::array<std::array<double, 4>, 4> m_storage;
 };
 
 /// ostream operator
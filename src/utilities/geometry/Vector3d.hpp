@@ -34,6 +34,7 @@
 #include "../data/Vector.hpp"
 #include "../core/Logger.hpp"
 
+#include <array>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -48,9 +49,6 @@ class UTILITIES_API Vector3d
   /// constructor with x, y, z
   Vector3d(double x, double y, double z);
 
-  /// copy constructor
-  Vector3d(const Vector3d& other);
-
   /// get x
   double x() const;
 
@@ -108,7 +106,7 @@ class UTILITIES_API Vector3d
  private:
   REGISTER_LOGGER("utilities.Vector3d");
 
-  Vector m_storage;
+  std::array<double, 3> m_storage;
 };
 
 /// ostream operator
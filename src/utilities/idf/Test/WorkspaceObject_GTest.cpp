@@ -42,6 +42,7 @@
 #include "../IdfObject.hpp"
 #include "../Workspace.hpp"
 #include "../WorkspaceObject.hpp"
+#include "../WorkspaceObject_Impl.hpp"
 
 #include "../../core/Optional.hpp"
 
@@ -505,6 +506,65 @@ TEST_F(IdfFixture, WorkspaceObject_Filter_Sources) {
   EXPECT_EQ(1, sourcesVector.size());
 }
 
+TEST_F(IdfFixture, WorkspaceObject_SourcesByType) {
+  Workspace ws(StrictnessLevel::Draft, IddFileType::OpenStudio);
+  OptionalWorkspaceObject node = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject node2 = ws.addObject(IdfObject(IddObjectType::OS_Node));
+  OptionalWorkspaceObject spm = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  OptionalWorkspaceObject spm2 = ws.addObject(IdfObject(IddObjectType::OS_SetpointManager_MixedAir));
+  ASSERT_TRUE(node && node2 && spm && spm2);
+
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node->handle()));
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node->handle()));
+  EXPECT_TRUE(spm2->setPointer(OS_SetpointManager_MixedAirFields::FanOutletNodeName, node->handle()));
+
+  auto nodeImpl = node->getImpl<detail::WorkspaceObject_Impl>();
+  EXPECT_EQ(3u, node->numSources());
+  EXPECT_EQ(2u, nodeImpl->numSourceObjects());
+  EXPECT_EQ(2u, nodeImpl->numSourceObjects(IddObjectType::OS_SetpointManager_MixedAir));
+  EXPECT_EQ(0u, nodeImpl->numSourceObjects(IddObjectType::OS_Node));
+  EXPECT_TRUE(node->getSources(IddObjectType::OS_Node).empty());
+
+  // results stay sorted and unique
+  WorkspaceObjectVector sources = node->getSources(IddObjectType::OS_SetpointManager_MixedAir);
+  ASSERT_EQ(2u, sources.size());
+  WorkspaceObjectVector expected{*spm, *spm2};
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(expected, sources);
+  EXPECT_EQ(expected, node->sources());
+
+  // index follows pointer changes
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::FanInletNodeName, node2->handle()));
+  EXPECT_EQ(2u, nodeImpl->numSourceObjects());
+  EXPECT_TRUE(spm->setPointer(OS_SetpointManager_MixedAirFields::SetpointNodeorNodeListName, node2->handle()));
+  EXPECT_EQ(1u, nodeImpl->numSourceObjects());
+  ASSERT_EQ(1u, node->sources().size());
+  EXPECT_EQ(spm2->handle(), node->sources()[0].handle());
+  EXPECT_EQ(1u, node2->getImpl<detail::WorkspaceObject_Impl>()->numSourceObjects(IddObjectType::OS_SetpointManager_MixedAir));
+
+  // and object removal
+  spm2->remove();
+  EXPECT_EQ(0u, nodeImpl->numSourceObjects());
+  EXPECT_TRUE(node->sources().empty());
+
+  // clones get their own index
+  for (bool keepHandles : {false, true}) {
+    Workspace clone = ws.clone(keepHandles);
+    std::vector<WorkspaceObject> nodes = clone.getObjectsByType(IddObjectType::OS_Node);
+    std::vector<WorkspaceObject> spms = clone.getObjectsByType(IddObjectType::OS_SetpointManager_MixedAir);
+    ASSERT_EQ(2u, nodes.size());
+    ASSERT_EQ(1u, spms.size());
+    unsigned nSources = 0;
+    for (const WorkspaceObject& n : nodes) {
+      for (const WorkspaceObject& source : n.getSources(IddObjectType::OS_SetpointManager_MixedAir)) {
+        EXPECT_EQ(spms[0], source);
+        ++nSources;
+      }
+    }
+    EXPECT_EQ(1u, nSources);
+  }
+}
+
 TEST_F(IdfFixture, WorkspaceObject_SetDouble_NaN_and_Inf) {
 
   // try with an WorkspaceObject
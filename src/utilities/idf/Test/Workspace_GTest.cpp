@@ -472,6 +472,76 @@ TEST_F(IdfFixture, Workspace_RemoveAllZones) {
   EXPECT_EQ(static_cast<size_t>(0), zones.size());
 }
 
+TEST_F(IdfFixture, Workspace_RemoveObjects_Bulk) {
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  workspace.order().setDirectOrder(HandleVector());
+
+  unsigned n = 2000;
+  WorkspaceObjectVector zones;
+  WorkspaceObjectVector lights;
+  for (unsigned i = 0; i < n; ++i) {
+    OptionalWorkspaceObject zone = workspace.addObject(IdfObject(IddObjectType::Zone));
+    ASSERT_TRUE(zone);
+    OptionalWorkspaceObject light = workspace.addObject(IdfObject(IddObjectType::Lights));
+    ASSERT_TRUE(light);
+    EXPECT_TRUE(light->setPointer(LightsFields::ZoneorZoneListName, zone->handle()));
+    zones.push_back(*zone);
+    lights.push_back(*light);
+  }
+  unsigned nObjects = workspace.numObjects();
+
+  // remove every other zone, plus a repeated and an unknown handle
+  HandleVector toRemove;
+  for (unsigned i = 0; i < n; i += 2) {
+    toRemove.push_back(zones[i].handle());
+  }
+  toRemove.push_back(zones[0].handle());
+  toRemove.push_back(createUUID());
+
+  openstudio::Time start = openstudio::Time::currentTime();
+  EXPECT_TRUE(workspace.removeObjects(toRemove));
+  openstudio::Time timingResult = openstudio::Time::currentTime() - start;
+  LOG(Info, "Removed " << n / 2 << " of " << nObjects << " objects in " << timingResult << " s.");
+
+  EXPECT_EQ(nObjects - n / 2, workspace.numObjects());
+  for (unsigned i = 0; i < n; ++i) {
+    if (i % 2 == 0) {
+      EXPECT_FALSE(zones[i].initialized());
+      EXPECT_FALSE(lights[i].getTarget(LightsFields::ZoneorZoneListName));
+    } else {
+      EXPECT_TRUE(zones[i].initialized());
+      ASSERT_TRUE(lights[i].getTarget(LightsFields::ZoneorZoneListName));
+      EXPECT_EQ(zones[i], lights[i].getTarget(LightsFields::ZoneorZoneListName).get());
+    }
+  }
+
+  // remaining objects keep their relative order
+  OptionalHandleVector directOrder = workspace.order().directOrder();
+  ASSERT_TRUE(directOrder);
+  HandleVector remainingOrder;
+  for (const Handle& h : *directOrder) {
+    OptionalWorkspaceObject object = workspace.getObject(h);
+    ASSERT_TRUE(object);
+    if (object->iddObject().type() != IddObjectType::Version) {
+      remainingOrder.push_back(h);
+    }
+  }
+  HandleVector expectedOrder;
+  for (unsigned i = 0; i < n; ++i) {
+    if (i % 2 == 1) {
+      expectedOrder.push_back(zones[i].handle());
+    }
+    expectedOrder.push_back(lights[i].handle());
+  }
+  EXPECT_EQ(expectedOrder, remainingOrder);
+
+  // removing the lights as well leaves the remaining zones without sources
+  EXPECT_TRUE(workspace.removeObjects(getHandles<WorkspaceObject>(lights)));
+  for (unsigned i = 1; i < n; i += 2) {
+    EXPECT_EQ(0u, zones[i].numSources());
+  }
+}
+
 TEST_F(IdfFixture, Workspace_SameNameNotReference) {
   Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
 
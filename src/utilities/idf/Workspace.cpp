@@ -1425,25 +1425,48 @@ namespace detail {
       return true;
     }
 
+    // look each object up once, skipping handles that are unknown or repeated
+    HandleVector removedHandles;
+    HandleHashSet removedSet;
     SavedWorkspaceObjectVector objectData;
+    removedSet.reserve(handles.size());
     for (const Handle& handle : handles) {
-      OptionalSavedWorkspaceObject candidate = savedWorkspaceObject(handle);
-      if (candidate) {
-        objectData.push_back(*candidate);
+      auto womIt = m_workspaceObjectMap.find(handle);
+      if ((womIt != m_workspaceObjectMap.end()) && removedSet.insert(handle).second) {
+        removedHandles.push_back(handle);
+        objectData.push_back(SavedWorkspaceObject(handle, womIt->second));
+      }
+    }
+
+    // positions in the direct order are only needed to roll back a removal that invalidates
+    // a Final workspace, and are then found in a single pass
+    if (!(m_strictnessLevel < StrictnessLevel::Final) && m_workspaceObjectOrder.isDirectOrder()) {
+      std::unordered_map<Handle, unsigned, boost::hash<boost::uuids::uuid>> orderIndices;
+      HandleVector directOrder = m_workspaceObjectOrder.directOrder().get();
+      for (unsigned i = 0, n = directOrder.size(); i < n; ++i) {
+        if (removedSet.find(directOrder[i]) != removedSet.end()) {
+          orderIndices[directOrder[i]] = i;
+        }
+      }
+      for (SavedWorkspaceObject& savedObject : objectData) {
+        auto it = orderIndices.find(savedObject.handle);
+        if (it != orderIndices.end()) {
+          savedObject.orderIndex = it->second;
+        }
       }
     }
 
-    for (SavedWorkspaceObject savedObject : objectData) {
+    for (const SavedWorkspaceObject& savedObject : objectData) {
       this->removeWorkspaceObject.nano_emit(WorkspaceObject(savedObject.objectImplPtr), savedObject.objectImplPtr->iddObject().type(),
                                             savedObject.handle);
       this->removeWorkspaceObjectPtr.nano_emit(savedObject.objectImplPtr, savedObject.objectImplPtr->iddObject().type(), savedObject.handle);
     }
 
     // actual work of removing from maps--is always successful
-    std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(handles);
+    std::vector<WorkspaceObjectVector> sources = nominallyRemoveObjects(removedHandles);
 
     if ((m_strictnessLevel < StrictnessLevel::Final) || isValid()) {
-      registerRemovalOfObjects(objectData, sources, handles);
+      registerRemovalOfObjects(objectData, sources, removedHandles);
       this->onChange.nano_emit();
       return true;
     } else {
@@ -2108,7 +2131,7 @@ namespace detail {
     return result;
   }
 
-  std::vector<WorkspaceObject> Workspace_Impl::nominallyRemoveObject(const Handle& handle) {
+  std::vector<WorkspaceObject> Workspace_Impl::nominallyRemoveObject(const Handle& handle, bool updateOrder) {
     // get object. should exist since call came from within Workspace.
     OptionalWorkspaceObject oObject = getObject(handle);
     if (!oObject) {
@@ -2168,7 +2191,7 @@ namespace detail {
     }
 
     // WorkspaceObjectOrder
-    if (m_workspaceObjectOrder.isDirectOrder()) {
+    if (updateOrder && m_workspaceObjectOrder.isDirectOrder()) {
       m_workspaceObjectOrder.erase(handle);
     }
 
@@ -2181,8 +2204,13 @@ namespace detail {
 
   std::vector<std::vector<WorkspaceObject>> Workspace_Impl::nominallyRemoveObjects(const std::vector<Handle>& handles) {
     std::vector<std::vector<WorkspaceObject>> sources;
+    sources.reserve(handles.size());
     for (const Handle& handle : handles) {
-      sources.push_back(nominallyRemoveObject(handle));
+      sources.push_back(nominallyRemoveObject(handle, false));
+    }
+    // one pass over the direct order, rather than a linear search per object
+    if (m_workspaceObjectOrder.isDirectOrder()) {
+      m_workspaceObjectOrder.erase(handles);
     }
     return sources;
   }
@@ -2203,8 +2231,19 @@ namespace detail {
 
   void Workspace_Impl::registerRemovalOfObjects(std::vector<SavedWorkspaceObject>& savedObjects,
                                                 const std::vector<std::vector<WorkspaceObject>>& sources, const std::vector<Handle>& removedHandles) {
-    for (int i = 0, n = savedObjects.size(); i < n; ++i) {
-      registerRemovalOfObject(savedObjects[i].objectImplPtr, sources[i], removedHandles);
+    // emit change signals once per remaining source, however many removed objects it pointed to
+    HandleHashSet removedSet(removedHandles.begin(), removedHandles.end());
+    HandleHashSet notifiedSet;
+    for (const WorkspaceObjectVector& objectSources : sources) {
+      for (const WorkspaceObject& source : objectSources) {
+        Handle sourceHandle = source.handle();
+        if ((removedSet.find(sourceHandle) == removedSet.end()) && notifiedSet.insert(sourceHandle).second) {
+          source.getImpl<detail::WorkspaceObject_Impl>()->emitChangeSignals();
+        }
+      }
+    }
+    for (SavedWorkspaceObject& savedObject : savedObjects) {
+      registerRemovalOfObject(savedObject.objectImplPtr, WorkspaceObjectVector(), removedHandles);
     }
   }
 
@@ -143,7 +143,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(), fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(this, fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -164,6 +164,7 @@ namespace detail {
       }
       m_targetData->reversePointers = mappedPointers;
     }
+    m_sourcesByType.reset();
   }
 
   // GETTERS
@@ -292,14 +293,14 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+      for (const SourcesByTypeMap::value_type& typeSources : sourcesByType()) {
+        for (const SourceCountMap::value_type& source : typeSources.second) {
+          result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(
+            std::const_pointer_cast<IdfObject_Impl>(source.first->shared_from_this()))));
+        }
       }
+      // each bucket is already sorted, and a source only appears in the bucket of its type
       std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -310,16 +311,15 @@ namespace detail {
       return result;
     }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) {
-          result.push_back(*owo);
+      const SourcesByTypeMap& index = sourcesByType();
+      auto it = index.find(type);
+      if (it != index.end()) {
+        result.reserve(it->second.size());
+        for (const SourceCountMap::value_type& source : it->second) {
+          result.push_back(WorkspaceObject(std::static_pointer_cast<WorkspaceObject_Impl>(
+            std::const_pointer_cast<IdfObject_Impl>(source.first->shared_from_this()))));
         }
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -724,6 +724,27 @@ namespace detail {
     return 0;
   }
 
+  unsigned WorkspaceObject_Impl::numSourceObjects() const {
+    unsigned result = 0;
+    if (initialized() && m_targetData) {
+      for (const SourcesByTypeMap::value_type& typeSources : sourcesByType()) {
+        result += typeSources.second.size();
+      }
+    }
+    return result;
+  }
+
+  unsigned WorkspaceObject_Impl::numSourceObjects(IddObjectType type) const {
+    if (initialized() && m_targetData) {
+      const SourcesByTypeMap& index = sourcesByType();
+      auto it = index.find(type);
+      if (it != index.end()) {
+        return it->second.size();
+      }
+    }
+    return 0;
+  }
+
   bool WorkspaceObject_Impl::isSource() const {
     if (!initialized()) {
       return false;
@@ -1007,6 +1028,7 @@ namespace detail {
     this->onRemoveFromWorkspace.nano_emit(m_handle);
     m_handle = Handle();
     m_workspace = nullptr;
+    m_sourcesByType.reset();
   }
 
   // Pre-condition:  field index is a pointer, and its targetHandle is either null or valid in
@@ -1018,7 +1040,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle, index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(this, index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(), index, target);
     }
@@ -1032,29 +1054,46 @@ namespace detail {
     OS_ASSERT(insertResult.second);
   }
 
-  // Pre-condition:  Object sourceHandle points to this object from field index.
+  // Pre-condition:  Object source points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl* source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle, index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(source->handle(), index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+
+    if (m_sourcesByType) {
+      auto typeIt = m_sourcesByType->find(source->iddObject().type());
+      OS_ASSERT(typeIt != m_sourcesByType->end());
+      auto sourceIt = typeIt->second.find(source);
+      OS_ASSERT(sourceIt != typeIt->second.end());
+      if (--(sourceIt->second) == 0) {
+        typeIt->second.erase(sourceIt);
+        if (typeIt->second.empty()) {
+          m_sourcesByType->erase(typeIt);
+        }
+      }
+    }
   }
 
-  // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
-  // Post-condition: m_targetData indicates that object sourceHandle points to this object from
+  // Pre-condition:  ReversePointer(source->handle(),index) is not in m_targetData.
+  // Post-condition: m_targetData indicates that object source points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(const WorkspaceObject_Impl* source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) {
       m_targetData = TargetData();
     }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator, bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle, index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(source->handle(), index));
     OS_ASSERT(insertResult.second);
+
+    if (m_sourcesByType) {
+      ++(*m_sourcesByType)[source->iddObject().type()][source];
+    }
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1067,7 +1106,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(), h.end(), m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(this, ptr.fieldIndex);
             }
           }
         }
@@ -1092,6 +1131,23 @@ namespace detail {
 
   // PRIVATE
 
+  const WorkspaceObject_Impl::SourcesByTypeMap& WorkspaceObject_Impl::sourcesByType() const {
+    if (!m_sourcesByType) {
+      m_sourcesByType = SourcesByTypeMap();
+      if (m_targetData) {
+        OS_ASSERT(m_workspace);
+        for (const ReversePointer& ptr : m_targetData->reversePointers) {
+          OS_ASSERT(!ptr.sourceHandle.isNull());
+          OptionalWorkspaceObject source = m_workspace->getObject(ptr.sourceHandle);
+          OS_ASSERT(source);
+          const WorkspaceObject_Impl* sourceImpl = source->getImpl<WorkspaceObject_Impl>().get();
+          ++(*m_sourcesByType)[sourceImpl->iddObject().type()][sourceImpl];
+        }
+      }
+    }
+    return *m_sourcesByType;
+  }
+
   // SETTERS
 
   // Pre-condition:  targetHandle is null or in m_workspace. index is an object-list field.
@@ -1125,7 +1181,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle, index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(this, index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle, index, targetHandle);
     }
@@ -33,6 +33,11 @@
 
 #include "../math/Permutation.hpp"
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <unordered_set>
+
 namespace openstudio {
 
 namespace detail {
@@ -163,6 +168,18 @@ namespace detail {
     return true;
   }
 
+  bool WorkspaceObjectOrder_Impl::erase(const std::vector<Handle>& handles) {
+    if (!m_directOrder) {
+      return false;
+    }
+    // one pass over the order, rather than a linear search per handle
+    std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> toErase(handles.begin(), handles.end());
+    m_directOrder->erase(
+      std::remove_if(m_directOrder->begin(), m_directOrder->end(), [&toErase](const Handle& h) { return toErase.find(h) != toErase.end(); }),
+      m_directOrder->end());
+    return true;
+  }
+
   void WorkspaceObjectOrder_Impl::setOrderByIddEnum() {
     ObjectOrderBase::setOrderByIddEnum();
     m_directOrder = boost::none;
@@ -437,6 +454,10 @@ bool WorkspaceObjectOrder::erase(const Handle& handle) {
   return m_impl->erase(handle);
 }
 
+bool WorkspaceObjectOrder::erase(const std::vector<Handle>& handles) {
+  return m_impl->erase(handles);
+}
+
 // SORTING
 
 std::vector<Handle> WorkspaceObjectOrder::sort(const std::vector<Handle>& handles) const {
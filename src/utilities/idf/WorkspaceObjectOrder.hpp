@@ -82,6 +82,8 @@ namespace detail {
     bool swap(const Handle& handle1, const Handle& handle2);
     /// returns false if not ordering directly, or request is otherwise invalid
     bool erase(const Handle& handle);
+    /// returns false if not ordering directly. handles not in the order are ignored.
+    bool erase(const std::vector<Handle>& handles);
 
     /// deletes other ordering options and orders by IddObjectType
     virtual void setOrderByIddEnum() override;
@@ -230,6 +232,8 @@ class UTILITIES_API WorkspaceObjectOrder
   bool swap(const Handle& handle1, const Handle& handle2);
   /// returns false if not ordering directly, or request is otherwise invalid
   bool erase(const Handle& handle);
+  /// returns false if not ordering directly. handles not in the order are ignored.
+  bool erase(const std::vector<Handle>& handles);
 
   // SORTING
 
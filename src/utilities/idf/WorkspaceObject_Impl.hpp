@@ -36,6 +36,8 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <map>
+
 namespace openstudio {
 
 // forward declarations
@@ -228,6 +230,14 @@ namespace detail {
     /** Returns the number of objects that point to this object. */
     unsigned numSources() const;
 
+    /** Returns the number of distinct objects that point to this object. Equivalent to
+     *  sources().size(), without constructing the objects. */
+    unsigned numSourceObjects() const;
+
+    /** Returns the number of distinct objects of type that point to this object. Equivalent to
+     *  getSources(type).size(), without constructing the objects. */
+    unsigned numSourceObjects(IddObjectType type) const;
+
     /** Returns true if this object points to another object. To qualify, there must be at least one
      *  pointer field holding a non-null pointer. */
     bool isSource() const;
@@ -311,9 +321,9 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl* source, unsigned index);
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(const WorkspaceObject_Impl* source, unsigned index);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -341,6 +351,16 @@ namespace detail {
     OptionalSourceData m_sourceData;
     OptionalTargetData m_targetData;
 
+    /** Sources of m_targetData's reverse pointers, bucketed by IddObjectType, with the number of
+     *  fields through which each source points here. Keys are impl pointers, which order the same
+     *  way as WorkspaceObject::operator<. Built lazily from m_targetData (it is not carried over by
+     *  copy or clone), then kept up to date by setReversePointer and nullifyReversePointer. */
+    typedef std::map<const WorkspaceObject_Impl*, unsigned> SourceCountMap;
+    typedef std::map<IddObjectType, SourceCountMap> SourcesByTypeMap;
+    mutable boost::optional<SourcesByTypeMap> m_sourcesByType;
+
+    const SourcesByTypeMap& sourcesByType() const;
+
     // SETTER HELPERS
 
     /** Sets pointer at field index to targetHandle, and returns old target. */
@@ -50,6 +50,7 @@
 #include <set>
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace openstudio {
 
@@ -484,6 +485,8 @@ namespace detail {
     typedef std::unordered_map<Handle, std::shared_ptr<WorkspaceObject_Impl>, boost::hash<boost::uuids::uuid>> WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
+    typedef std::unordered_set<Handle, boost::hash<boost::uuids::uuid>> HandleHashSet;
+
     // object for ordering objects in the collection.
     WorkspaceObjectOrder m_workspaceObjectOrder;
 
@@ -554,7 +557,9 @@ namespace detail {
 
     OptionalSavedWorkspaceObject savedWorkspaceObject(const Handle& handle);
 
-    std::vector<WorkspaceObject> nominallyRemoveObject(const Handle& handle);
+    /** Unlinks object handle and removes it from the maps. If !updateOrder, the caller is
+     *  responsible for erasing handle from m_workspaceObjectOrder. */
+    std::vector<WorkspaceObject> nominallyRemoveObject(const Handle& handle, bool updateOrder = true);
 
     std::vector<std::vector<WorkspaceObject>> nominallyRemoveObjects(const std::vector<Handle>& handles);
 
@@ -33,6 +33,7 @@
 #include "OpenStudio.hxx"
 
 #include "../time/Calendar.hpp"
+#include "../time/Timestamp.hpp"
 #include "../filetypes/EpwFile.hpp"
 #include "../core/Containers.hpp"
 #include "../core/Assert.hpp"
@@ -672,9 +673,13 @@ namespace detail {
     execAndThrowOnError(insertReportDataDictionary.str());
 
     std::vector<double> values = toStandardVector(t_timeSeries.values());
-    std::vector<double> days = toStandardVector(t_timeSeries.daysFromFirstReport());
+    std::vector<long> seconds = t_timeSeries.secondsFromFirstReport();
 
+    // work in whole seconds on the local clock of the first report, calendar fields are then integer arithmetic
     openstudio::DateTime firstdate = t_timeSeries.firstReportDateTime();
+    openstudio::Date firstDate = firstdate.date();
+    openstudio::Timestamp firstReport = openstudio::Timestamp::fromCivil(firstDate.year(), openstudio::month(firstDate.monthOfYear()),
+                                                                         firstDate.dayOfMonth(), 0, 0, firstdate.time().totalSeconds());
 
     std::shared_ptr<PreparedStatement> stmt;
     if (hasYear()) {
@@ -690,24 +695,15 @@ namespace detail {
     }
 
     for (size_t i = 0; i < values.size(); ++i) {
-      openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
+      openstudio::Timestamp timestamp = firstReport + seconds[i];
       double value = values[i];
 
-      if (dt.time().seconds() == 59) {
-        // rounding error, let's help
-        dt += openstudio::Time(0, 0, 0, 1);
-      }
-
-      if (dt.time().seconds() == 1) {
-        // rounding error, let's help
-        dt -= openstudio::Time(0, 0, 0, 1);
-      }
-
-      int year = dt.date().year();
-      int month = dt.date().monthOfYear().value();
-      int day = dt.date().dayOfMonth();
-      int hour = dt.time().hours();
-      int minute = dt.time().minutes();
+      int year;
+      unsigned month;
+      unsigned day;
+      timestamp.civil(year, month, day);
+      int hour = timestamp.hours();
+      int minute = timestamp.minutes();
 
       ++hour;  // energyplus says time goes from 1-24 not from 0-23
 
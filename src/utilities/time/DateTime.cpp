@@ -28,6 +28,7 @@
 ***********************************************************************************************************************/
 
 #include "DateTime.hpp"
+#include "Timestamp.hpp"
 #include <fmt/format.h>
 
 using namespace std;
@@ -218,11 +219,8 @@ std::string DateTime::toXsdDateTime() const {
 }
 
 std::time_t DateTime::toEpoch() const {
-  // credit: http://stackoverflow.com/questions/4461586/how-do-i-convert-boostposix-timeptime-to-time-t
-  boost::posix_time::ptime pt(m_date.impl(), m_time.impl() - boost::posix_time::time_duration(utcOffsetHours(), utcOffsetMinutes(), 0, 0));
-  boost::posix_time::ptime epoch(boost::gregorian::date(1970, 1, 1));
-  boost::posix_time::time_duration::sec_type x = (pt - epoch).total_seconds();
-  return std::time_t(x);
+  // Timestamp works on integer calendar fields, avoiding boost::posix_time::ptime construction on every comparison
+  return std::time_t(Timestamp::fromDateTime(*this).secondsSinceEpoch());
 }
 
 boost::optional<DateTime> DateTime::fromISO8601(const std::string& str) {
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "../Timestamp.hpp"
+#include "../DateTime.hpp"
+
+#include <algorithm>
+#include <type_traits>
+
+using namespace openstudio;
+
+TEST(Timestamp, Civil) {
+  static_assert(std::is_trivially_copyable<Timestamp>::value, "Timestamp should be trivially copyable");
+  static_assert(Timestamp::fromCivil(1970, 1, 1).secondsSinceEpoch() == 0, "epoch");
+  static_assert(Timestamp::fromCivil(2000, 3, 1).secondsSinceEpoch() == 951868800, "2000-03-01");
+
+  Timestamp t = Timestamp::fromCivil(2008, 2, 29, 23, 59, 59);
+  int year;
+  unsigned month;
+  unsigned day;
+  t.civil(year, month, day);
+  EXPECT_EQ(2008, year);
+  EXPECT_EQ(2u, month);
+  EXPECT_EQ(29u, day);
+  EXPECT_EQ(23, t.hours());
+  EXPECT_EQ(59, t.minutes());
+  EXPECT_EQ(59, t.seconds());
+
+  t += 1;
+  EXPECT_EQ(2008, t.year());
+  EXPECT_EQ(3u, t.month());
+  EXPECT_EQ(1u, t.dayOfMonth());
+  EXPECT_EQ(0, t.secondsOfDay());
+
+  // before the epoch
+  Timestamp before = Timestamp::fromCivil(1969, 12, 31, 23, 0, 0);
+  EXPECT_EQ(-3600, before.secondsSinceEpoch());
+  EXPECT_EQ(-1, before.daysSinceEpoch());
+  EXPECT_EQ(23, before.hours());
+  EXPECT_EQ(1969, before.year());
+  EXPECT_EQ(12u, before.month());
+  EXPECT_EQ(31u, before.dayOfMonth());
+
+  // hour 24 rolls into the next day
+  EXPECT_EQ(Timestamp::fromCivil(2009, 1, 1), Timestamp::fromCivil(2008, 12, 31, 24, 0, 0));
+}
+
+TEST(Timestamp, DateTime) {
+  DateTime dateTime(Date(MonthOfYear::Jul, 4, 2016), Time(0, 13, 30, 15));
+  Timestamp t = Timestamp::fromDateTime(dateTime);
+  EXPECT_EQ(dateTime.toEpoch(), t.secondsSinceEpoch());
+  EXPECT_EQ(dateTime, t.toDateTime());
+
+  // UTC offset is applied
+  DateTime local(Date(MonthOfYear::Jul, 4, 2016), Time(0, 13, 30, 15), -6.5);
+  Timestamp utc = Timestamp::fromDateTime(local);
+  EXPECT_EQ(6 * 3600 + 30 * 60, utc - t);
+  EXPECT_EQ(local, utc.toDateTime());
+  EXPECT_EQ(20, utc.hours());
+  EXPECT_EQ(0, utc.minutes());
+
+  // dates without a base year use the assumed base year
+  DateTime noYear(Date(MonthOfYear::Jan, 1), Time(0, 1, 0, 0));
+  EXPECT_EQ(noYear.date().year(), Timestamp::fromDateTime(noYear).year());
+  EXPECT_EQ(noYear.toEpoch(), Timestamp::fromDateTime(noYear).secondsSinceEpoch());
+}
+
+TEST(Timestamp, SortAndMerge) {
+  Timestamp start = Timestamp::fromCivil(2009, 1, 1);
+  TimestampVector hourly;
+  TimestampVector subHourly;
+  for (int i = 0; i < 8760; ++i) {
+    hourly.push_back(start + 3600 * ((i * 7919) % 8760));
+    subHourly.push_back(start + 900 * i + 1);
+  }
+  std::sort(hourly.begin(), hourly.end());
+  EXPECT_TRUE(std::adjacent_find(hourly.begin(), hourly.end(), [](const Timestamp& a, const Timestamp& b) { return !(a < b); }) == hourly.end());
+  EXPECT_EQ(start, hourly.front());
+
+  TimestampVector merged;
+  std::merge(hourly.begin(), hourly.end(), subHourly.begin(), subHourly.end(), std::back_inserter(merged));
+  ASSERT_EQ(hourly.size() + subHourly.size(), merged.size());
+  EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()));
+}
@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#include "Timestamp.hpp"
+#include "DateTime.hpp"
+
+#include <fmt/format.h>
+
+namespace openstudio {
+
+Timestamp Timestamp::fromDateTime(const DateTime& dateTime) {
+  Date date = dateTime.date();
+  // same truncation of fractional offsets as DateTime::toEpoch
+  double utcOffset = dateTime.utcOffset();
+  int offsetHours = static_cast<int>(utcOffset);
+  int offsetMinutes = static_cast<int>(60 * (utcOffset - offsetHours));
+  return fromCivil(date.year(), openstudio::month(date.monthOfYear()), date.dayOfMonth(), -offsetHours, -offsetMinutes,
+                   dateTime.time().totalSeconds());
+}
+
+DateTime Timestamp::toDateTime() const {
+  int y;
+  unsigned m;
+  unsigned d;
+  civil(y, m, d);
+  return DateTime(Date(openstudio::monthOfYear(m), d, y), Time(0, 0, 0, secondsOfDay()), 0.0);
+}
+
+int Timestamp::year() const {
+  int y;
+  unsigned m;
+  unsigned d;
+  civil(y, m, d);
+  return y;
+}
+
+unsigned Timestamp::month() const {
+  int y;
+  unsigned m;
+  unsigned d;
+  civil(y, m, d);
+  return m;
+}
+
+unsigned Timestamp::dayOfMonth() const {
+  int y;
+  unsigned m;
+  unsigned d;
+  civil(y, m, d);
+  return d;
+}
+
+void Timestamp::civil(int& year, unsigned& month, unsigned& day) const {
+  // inverse of daysFromCivil
+  const std::int64_t z = daysSinceEpoch() + 719468;
+  const std::int64_t era = floorDiv(z, 146097);
+  const std::int64_t doe = z - era * 146097;
+  const std::int64_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const std::int64_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const std::int64_t mp = (5 * doy + 2) / 153;
+  day = static_cast<unsigned>(doy - (153 * mp + 2) / 5 + 1);
+  month = static_cast<unsigned>(mp < 10 ? mp + 3 : mp - 9);
+  year = static_cast<int>(yoe + era * 400 + (month <= 2 ? 1 : 0));
+}
+
+std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp) {
+  int y;
+  unsigned m;
+  unsigned d;
+  timestamp.civil(y, m, d);
+  os << fmt::format("{:04d}-{:02d}-{:02d}T{:02d}:{:02d}:{:02d}Z", y, m, d, timestamp.hours(), timestamp.minutes(), timestamp.seconds());
+  return os;
+}
+
+}  // namespace openstudio
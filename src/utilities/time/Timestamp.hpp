@@ -0,0 +1,184 @@
+/***********************************************************************************************************************
+*  OpenStudio(R), Copyright (c) 2008-2020, Alliance for Sustainable Energy, LLC, and other contributors. All rights reserved.
+*
+*  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+*  following conditions are met:
+*
+*  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+*  disclaimer.
+*
+*  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the following
+*  disclaimer in the documentation and/or other materials provided with the distribution.
+*
+*  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote products
+*  derived from this software without specific prior written permission from the respective party.
+*
+*  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative works
+*  may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without specific prior
+*  written permission from Alliance for Sustainable Energy, LLC.
+*
+*  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDER(S) AND ANY CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+*  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+*  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER(S), ANY CONTRIBUTORS, THE UNITED STATES GOVERNMENT, OR THE UNITED
+*  STATES DEPARTMENT OF ENERGY, NOR ANY OF THEIR EMPLOYEES, BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+*  EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF
+*  USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+*  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+*  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+***********************************************************************************************************************/
+
+#ifndef UTILITIES_TIME_TIMESTAMP_HPP
+#define UTILITIES_TIME_TIMESTAMP_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include <cstdint>
+#include <iosfwd>
+#include <vector>
+
+namespace openstudio {
+
+class DateTime;
+
+/// Timestamp is a compact absolute point in time, stored as whole seconds since 1970-01-01 00:00:00 UTC
+/// Timestamp is trivially copyable and cheap to compare, use it for large time axes and convert to DateTime at API boundaries
+/// calendar fields are computed in UTC using the proleptic Gregorian calendar
+class UTILITIES_API Timestamp
+{
+ public:
+  /// default constructor, 1970-01-01 00:00:00 UTC
+  constexpr Timestamp() : m_secondsSinceEpoch(0) {}
+
+  /// constructor from seconds since 1970-01-01 00:00:00 UTC
+  constexpr explicit Timestamp(std::int64_t secondsSinceEpoch) : m_secondsSinceEpoch(secondsSinceEpoch) {}
+
+  /// constructor from calendar fields in UTC, month is 1-12, hours/minutes/seconds may be outside of their normal range
+  static constexpr Timestamp fromCivil(int year, unsigned month, unsigned day, int hours = 0, int minutes = 0, std::int64_t seconds = 0) {
+    return Timestamp(SECONDS_PER_DAY * daysFromCivil(year, month, day) + 3600 * hours + 60 * minutes + seconds);
+  }
+
+  /// constructor from DateTime, date is interpreted in its (assumed) base year and UTC offset is applied
+  static Timestamp fromDateTime(const DateTime& dateTime);
+
+  /// convert to DateTime in UTC, the date has an explicit base year
+  DateTime toDateTime() const;
+
+  /// seconds since 1970-01-01 00:00:00 UTC
+  constexpr std::int64_t secondsSinceEpoch() const {
+    return m_secondsSinceEpoch;
+  }
+
+  /// whole days since 1970-01-01, rounded towards negative infinity
+  constexpr std::int64_t daysSinceEpoch() const {
+    return floorDiv(m_secondsSinceEpoch, SECONDS_PER_DAY);
+  }
+
+  /// seconds since the start of the day, 0 <= secondsOfDay < 86400
+  constexpr int secondsOfDay() const {
+    return static_cast<int>(m_secondsSinceEpoch - SECONDS_PER_DAY * daysSinceEpoch());
+  }
+
+  /// calendar year
+  int year() const;
+
+  /// calendar month, 1-12
+  unsigned month() const;
+
+  /// day of month, 1-31
+  unsigned dayOfMonth() const;
+
+  /// hours of day, 0-23
+  constexpr int hours() const {
+    return secondsOfDay() / 3600;
+  }
+
+  /// minutes after the hour, 0-59
+  constexpr int minutes() const {
+    return (secondsOfDay() % 3600) / 60;
+  }
+
+  /// seconds after the minute, 0-59
+  constexpr int seconds() const {
+    return secondsOfDay() % 60;
+  }
+
+  /// get year, month and day in one pass
+  void civil(int& year, unsigned& month, unsigned& day) const;
+
+  constexpr Timestamp operator+(std::int64_t seconds) const {
+    return Timestamp(m_secondsSinceEpoch + seconds);
+  }
+
+  constexpr Timestamp operator-(std::int64_t seconds) const {
+    return Timestamp(m_secondsSinceEpoch - seconds);
+  }
+
+  Timestamp& operator+=(std::int64_t seconds) {
+    m_secondsSinceEpoch += seconds;
+    return *this;
+  }
+
+  Timestamp& operator-=(std::int64_t seconds) {
+    m_secondsSinceEpoch -= seconds;
+    return *this;
+  }
+
+  /// difference in seconds
+  constexpr std::int64_t operator-(const Timestamp& other) const {
+    return m_secondsSinceEpoch - other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator==(const Timestamp& other) const {
+    return m_secondsSinceEpoch == other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator!=(const Timestamp& other) const {
+    return m_secondsSinceEpoch != other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator<(const Timestamp& other) const {
+    return m_secondsSinceEpoch < other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator<=(const Timestamp& other) const {
+    return m_secondsSinceEpoch <= other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator>(const Timestamp& other) const {
+    return m_secondsSinceEpoch > other.m_secondsSinceEpoch;
+  }
+
+  constexpr bool operator>=(const Timestamp& other) const {
+    return m_secondsSinceEpoch >= other.m_secondsSinceEpoch;
+  }
+
+  /// days since 1970-01-01 for a date in the proleptic Gregorian calendar, month is 1-12
+  static constexpr std::int64_t daysFromCivil(int year, unsigned month, unsigned day) {
+    // credit: Howard Hinnant, chrono-Compatible Low-Level Date Algorithms
+    const std::int64_t y = static_cast<std::int64_t>(year) - (month <= 2 ? 1 : 0);
+    const std::int64_t era = floorDiv(y, 400);
+    const std::int64_t yoe = y - era * 400;
+    const std::int64_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const std::int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+  }
+
+ private:
+  static constexpr std::int64_t SECONDS_PER_DAY = 86400;
+
+  static constexpr std::int64_t floorDiv(std::int64_t a, std::int64_t b) {
+    return (a >= 0) ? (a / b) : -((-a + b - 1) / b);
+  }
+
+  std::int64_t m_secondsSinceEpoch;
+};
+
+/// vector of Timestamp
+typedef std::vector<Timestamp> TimestampVector;
+
+// std::ostream operator<<, ISO 8601 in UTC
+UTILITIES_API std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp);
+
+}  // namespace openstudio
+
+#endif  // UTILITIES_TIME_TIMESTAMP_HPP
@@ -44,6 +44,11 @@
 #include "WhUnit.hpp"
 
 #include "../core/Assert.hpp"
+#include "../data/TimeSeries.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <mutex>
 
 namespace openstudio {
 
@@ -468,31 +473,190 @@ boost::optional<Quantity> QuantityConverterSingleton::m_convertToTargetFromSI(co
   return converted;
 }
 
+namespace {
+
+  /** Conversion between two unit strings. Every conversion done by QuantityConverter is affine, the value in final
+   *  units is offset + scale * (value in original units). */
+  struct ConversionPlan
+  {
+    double scale;
+    double offset;
+    // false if the conversion was not found to be affine, each value is then converted with QuantityConverter
+    bool affine;
+  };
+
+  boost::optional<double> convertWithUnits(double original, const std::string& originalUnits, const std::string& finalUnits) {
+    //create the units from the strings
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+
+    //make sure both unit strings were valid
+    if (originalUnit && finalUnit) {
+
+      //make the original quantity
+      Quantity originalQuant = Quantity(original, *originalUnit);
+
+      //convert to final units
+      boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
+
+      //if the conversion
+      if (finalQuant) {
+        return finalQuant->value();
+      }
+    }
+
+    return boost::none;
+  }
+
+  boost::optional<ConversionPlan> makeConversionPlan(const std::string& originalUnits, const std::string& finalUnits) {
+    boost::optional<double> offset = convertWithUnits(0.0, originalUnits, finalUnits);
+    if (!offset) {
+      return boost::none;
+    }
+
+    ConversionPlan result{1.0, *offset, true};
+    if (*offset == 0.0) {
+      result.scale = convertWithUnits(1.0, originalUnits, finalUnits).get();
+    } else {
+      // a large probe value keeps the scale accurate when the offset is large, e.g. temperatures
+      const double probe = 1.0e6;
+      result.scale = (convertWithUnits(probe, originalUnits, finalUnits).get() - *offset) / probe;
+    }
+
+    // check the plan against a direct conversion
+    const double check = -123.456;
+    double expected = convertWithUnits(check, originalUnits, finalUnits).get();
+    double planned = result.offset + result.scale * check;
+    if (std::fabs(planned - expected) > 1.0e-9 * std::max(1.0, std::fabs(expected))) {
+      LOG_FREE(Warn, "openstudio.units.QuantityConverter",
+               "Conversion from '" << originalUnits << "' to '" << finalUnits << "' is not affine, values will be converted one at a time.");
+      result.affine = false;
+    }
+
+    return result;
+  }
+
+  /// returns the cached plan for converting from originalUnits to finalUnits, boost::none if the units can not be converted
+  boost::optional<ConversionPlan> conversionPlan(const std::string& originalUnits, const std::string& finalUnits) {
+    static std::mutex mutex;
+    static std::map<std::pair<std::string, std::string>, boost::optional<ConversionPlan>> plans;
+
+    std::pair<std::string, std::string> key(originalUnits, finalUnits);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      auto it = plans.find(key);
+      if (it != plans.end()) {
+        return it->second;
+      }
+    }
+
+    // make the plan without holding the lock, another thread may do the same but will get the same result
+    boost::optional<ConversionPlan> plan = makeConversionPlan(originalUnits, finalUnits);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    plans.emplace(key, plan);
+    return plan;
+  }
+
+  void applyConversionPlan(const ConversionPlan& plan, const double* original, double* result, std::size_t n) {
+    const double scale = plan.scale;
+    const double offset = plan.offset;
+    if (offset == 0.0) {
+      for (std::size_t i = 0; i < n; ++i) {
+        result[i] = scale * original[i];
+      }
+    } else {
+      for (std::size_t i = 0; i < n; ++i) {
+        result[i] = offset + scale * original[i];
+      }
+    }
+  }
+
+  /// converts n values with the plan, returns false if a value could not be converted
+  bool convertValues(const ConversionPlan& plan, const std::string& originalUnits, const std::string& finalUnits, const double* original,
+                     double* result, std::size_t n) {
+    if (plan.affine) {
+      applyConversionPlan(plan, original, result, n);
+      return true;
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+      boost::optional<double> value = convertWithUnits(original[i], originalUnits, finalUnits);
+      if (!value) {
+        return false;
+      }
+      result[i] = *value;
+    }
+    return true;
+  }
+
+}  // namespace
+
 boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits) {
   if (originalUnits == finalUnits) {
     return original;
   }
 
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+  boost::optional<ConversionPlan> plan = conversionPlan(originalUnits, finalUnits);
+  if (!plan) {
+    return boost::none;
+  }
 
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
+  double result = 0.0;
+  if (!convertValues(*plan, originalUnits, finalUnits, &original, &result, 1)) {
+    return boost::none;
+  }
+  return result;
+}
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits, const std::string& finalUnits) {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
+  boost::optional<ConversionPlan> plan = conversionPlan(originalUnits, finalUnits);
+  if (!plan) {
+    return boost::none;
+  }
 
-    //if the conversion
-    if (finalQuant) {
-      return finalQuant->value();
-    }
+  std::vector<double> result(original.size());
+  if (!convertValues(*plan, originalUnits, finalUnits, original.data(), result.data(), original.size())) {
+    return boost::none;
+  }
+  return result;
+}
+
+boost::optional<Vector> convert(const Vector& original, const std::string& originalUnits, const std::string& finalUnits) {
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  boost::optional<ConversionPlan> plan = conversionPlan(originalUnits, finalUnits);
+  if (!plan) {
+    return boost::none;
   }
 
-  return boost::none;
+  Vector result(original.size());
+  if ((original.size() > 0) && !convertValues(*plan, originalUnits, finalUnits, &original[0], &result[0], original.size())) {
+    return boost::none;
+  }
+  return result;
+}
+
+boost::optional<TimeSeries> convert(const TimeSeries& original, const std::string& finalUnits) {
+  std::string originalUnits = original.units();
+  if (originalUnits == finalUnits) {
+    return original;
+  }
+
+  boost::optional<Vector> values = convert(original.values(), originalUnits, finalUnits);
+  if (!values) {
+    return boost::none;
+  }
+
+  if (boost::optional<Time> intervalLength = original.intervalLength()) {
+    return TimeSeries(original.firstReportDateTime(), *intervalLength, *values, finalUnits);
+  }
+  return TimeSeries(original.firstReportDateTime(), original.secondsFromFirstReport(), *values, finalUnits);
 }
 
 boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys) {
@@ -35,13 +35,16 @@
 #include "../core/Logger.hpp"
 
 #include "Unit.hpp"
+#include "../data/Vector.hpp"
 #include <string>
 #include <map>
+#include <vector>
 
 namespace openstudio {
 
 class Quantity;
 class OSQuantityVector;
+class TimeSeries;
 
 // JMT@20100902 - it's necessary to move the temperature conversion
 //                rule enum into a class that is *not* %ignored by swig, if we want
@@ -120,9 +123,23 @@ class UTILITIES_API QuantityConverterSingleton
 /** \relates QuantityConverterSingleton */
 typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 
-/** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
+/** Non-member function to simplify interface for users. The scale and offset between a pair of unit strings
+ *  are computed on first use and cached, so later calls with the same units do not parse or convert units.
+ *  \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Converts all values from originalUnits to finalUnits using the cached scale and offset for the pair of units.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API boost::optional<std::vector<double>> convert(const std::vector<double>& original, const std::string& originalUnits,
+                                                           const std::string& finalUnits);
+
+/** \overload */
+UTILITIES_API boost::optional<Vector> convert(const Vector& original, const std::string& originalUnits, const std::string& finalUnits);
+
+/** Converts the values of original from original.units() to finalUnits, the result has units finalUnits.
+ *  \relates QuantityConverterSingleton \relates TimeSeries */
+UTILITIES_API boost::optional<TimeSeries> convert(const TimeSeries& original, const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
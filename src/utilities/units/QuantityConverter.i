@@ -8,6 +8,10 @@
 // hide shared_ptrs, expose helper functions
 %ignore QuantityConverterSingleton;
 %ignore QuantityConverter;
+// bulk conversions are not wrapped
+%ignore openstudio::convert(const std::vector<double>&, const std::string&, const std::string&);
+%ignore openstudio::convert(const Vector&, const std::string&, const std::string&);
+%ignore openstudio::convert(const TimeSeries&, const std::string&);
 %include <utilities/units/QuantityConverter.hpp>
 
 #endif // UTILITIES_UNITS_QUANTITYCONVERTER_I
@@ -44,6 +44,8 @@
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
 
+#include "../../data/TimeSeries.hpp"
+
 using namespace openstudio;
 
 TEST_F(UnitsFixture, QuantityConverter_IPandSIUsingSystem) {
@@ -266,3 +268,46 @@ TEST_F(UnitsFixture, QuantityConverter_Profiling_OSQuantityVector) {
   OSQuantityVector result = convert(testOSQuantityVector, UnitSystem(UnitSystem::Wh));
   EXPECT_EQ(8760u, result.size());
 }
+
+TEST_F(UnitsFixture, QuantityConverter_ConvertValues) {
+  // cached conversions agree with converting quantities
+  OptionalUnit w = UnitFactory::instance().createUnit("W/m^2");
+  OptionalUnit btu = UnitFactory::instance().createUnit("Btu/h*ft^2");
+  ASSERT_TRUE(w);
+  ASSERT_TRUE(btu);
+  OptionalQuantity q = QuantityConverter::instance().convert(Quantity(123.4, *w), *btu);
+  ASSERT_TRUE(q);
+  ASSERT_TRUE(convert(123.4, "W/m^2", "Btu/h*ft^2"));
+  EXPECT_DOUBLE_EQ(q->value(), convert(123.4, "W/m^2", "Btu/h*ft^2").get());
+
+  ASSERT_TRUE(convert(100.0, "C", "F"));
+  EXPECT_NEAR(212.0, convert(100.0, "C", "F").get(), 1.0E-12);
+  EXPECT_NEAR(-40.0, convert(-40.0, "F", "C").get(), 1.0E-12);
+  EXPECT_FALSE(convert(1.0, "m", "kg"));
+  EXPECT_FALSE(convert(1.0, "m", "kg"));
+
+  std::vector<double> values{-10.0, 0.0, 21.5, 100.0};
+  boost::optional<std::vector<double>> converted = convert(values, "C", "F");
+  ASSERT_TRUE(converted);
+  ASSERT_EQ(values.size(), converted->size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(convert(values[i], "C", "F").get(), (*converted)[i]);
+  }
+  EXPECT_FALSE(convert(values, "C", "m"));
+
+  boost::optional<Vector> convertedVector = convert(createVector(values), "m", "ft");
+  ASSERT_TRUE(convertedVector);
+  ASSERT_EQ(values.size(), convertedVector->size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(convert(values[i], "m", "ft").get(), (*convertedVector)[i]);
+  }
+
+  TimeSeries timeSeries(Date(MonthOfYear::Jan, 1), Time(0, 1), createVector(values), "C");
+  boost::optional<TimeSeries> convertedTimeSeries = convert(timeSeries, "F");
+  ASSERT_TRUE(convertedTimeSeries);
+  EXPECT_EQ("F", convertedTimeSeries->units());
+  EXPECT_EQ(timeSeries.firstReportDateTime(), convertedTimeSeries->firstReportDateTime());
+  ASSERT_EQ(values.size(), convertedTimeSeries->values().size());
+  EXPECT_NEAR(212.0, convertedTimeSeries->values()[3], 1.0E-12);
+  EXPECT_FALSE(convert(timeSeries, "m"));
+}